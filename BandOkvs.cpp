@@ -0,0 +1,170 @@
+#include "BandOkvs.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace volePSI
+{
+	void BandParam::init(u64 numItems, u64 bandWidth, u64 ssp)
+	{
+		// the over-provisioning needed for encoding to fail with probability
+		// at most 2^-ssp. As in the RB-OKVS analysis the failure probability
+		// decays exponentially in bandWidth * eps, so we model
+		//
+		//   log2 Pr[fail] ~= a log2(n) + b - s eps
+		//
+		// and solve for eps. a, b and s are fitted per band width to simulated
+		// encodings of n = 2^12 .. 2^19 keys, rounded to the conservative side:
+		//
+		//   w=512: eps=0,      n=2^17: 1 in 5.   eps=0.0015, n=2^17: 1 in 18.
+		//          eps=0.003,  n=2^17: 1 in 60.  eps=0.0045, n=2^17: 1 in 200.
+		//          eps=0.003,  n=2^19: 1 in 3.   eps=0.006,  n=2^19: 1 in 30.
+		//   w=256: eps=0.005,  n=2^17: 1 in 2.   eps=0.01,   n=2^17: 1 in 9.
+		//          eps=0.015,  n=2^17: 1 in 42.  eps=0.003,  n=2^14: 1 in 670.
+		//   w=128: eps=0.03,   n=2^17: 1 in 10.  eps=0.05,   n=2^17: 1 in 290.
+		//          eps=0.04,   n=2^14: 1 in 1500. eps=0.05,  n=2^14: 1 in 10^4.
+		//   w=64:  eps=0.05,   n=2^14: 1 in 5.   eps=0.09,   n=2^14: 1 in 130.
+		//          eps=0.13,   n=2^14: 1 in 10^4. eps=0.12,  n=2^12: 1 in 1.7*10^4.
+		//
+		// Checked against the formula at small ssp: ssp=8, n=2^17 gives 1 in
+		// 500 (w=512) and 0 in 500 (w=256), ssp=12 gives 1 in 1.4*10^4 (w=64,
+		// n=2^12) and 1 in 10^4 (w=128, n=2^14). Larger ssp are an
+		// extrapolation of the exponential tail, which only got steeper over
+		// the measured range. For ssp=40 and n=2^20 this gives eps ~0.04 for
+		// 512 bit bands, ~0.11 for 256, ~0.22 for 128 and ~0.45 for 64.
+		double a, b, s;
+		if (bandWidth == 512)
+			a = 2.2, b = -40.0, s = 1100;
+		else if (bandWidth == 256)
+			a = 2.5, b = -40.2, s = 445;
+		else if (bandWidth == 128)
+			a = 1.5, b = -21.8, s = 220;
+		else
+			a = 1.4, b = -15.7, s = 115;
+
+		auto logN = std::log2(double(std::max<u64>(numItems, 1)));
+		auto eps = std::max(0.002, (ssp + a * logN + b) / s);
+
+		init(numItems, bandWidth, ssp, eps);
+	}
+
+	void BandParam::init(u64 numItems, u64 bandWidth, u64 ssp, double epsilon)
+	{
+		if (bandWidth != 64 && bandWidth != 128 && bandWidth != 256 && bandWidth != 512)
+			throw std::runtime_error("band width must be 64, 128, 256 or 512. " LOCATION);
+		if (epsilon < 0)
+			throw std::runtime_error("epsilon must be non-negative. " LOCATION);
+
+		mNumItems = numItems;
+		mBandWidth = bandWidth;
+		mSsp = ssp;
+		mEpsilon = epsilon;
+
+		// the last band must fit entirely, hence the + bandWidth.
+		mSize = static_cast<u64>(std::ceil(numItems * (1 + epsilon))) + bandWidth;
+	}
+
+	void BandOkvs::init(u64 numItems, BandParam p, block seed)
+	{
+		if (p.mSize < numItems + p.mBandWidth)
+			throw RTE_LOC;
+
+		static_cast<BandParam&>(*this) = p;
+		mNumItems = numItems;
+		mSeed = seed;
+		mAes.setKey(seed);
+		mStarts.clear();
+		mBands.clear();
+	}
+
+	void BandOkvs::hashBuildRow32(const block* input, u64* starts, u64* bands) const
+	{
+		std::array<block, 32> h0, h1;
+		mAes.hashBlocks(input, 32, h0.data());
+
+		auto range = mSize - mBandWidth + 1;
+		for (u64 k = 0; k < 32; ++k)
+			starts[k] = fastRange(h0[k].get<u64>(0), range);
+
+		// every further hash of the chain gives 128 bits of the bands.
+		auto words = bandWords();
+		for (u64 j = 0; j < words; j += 2)
+		{
+			mAes.hashBlocks(h0.data(), 32, h1.data());
+			for (u64 k = 0; k < 32; ++k)
+			{
+				auto b = bands + k * words + j;
+				b[0] = h1[k].get<u64>(0);
+				if (j + 1 < words)
+					b[1] = h1[k].get<u64>(1);
+			}
+			std::swap(h0, h1);
+		}
+
+		for (u64 k = 0; k < 32; ++k)
+			bands[k * words] |= 1;
+	}
+
+	void BandOkvs::hashBuildRow1(const block* input, u64* starts, u64* bands) const
+	{
+		auto h = mAes.hashBlock(*input);
+
+		auto range = mSize - mBandWidth + 1;
+		starts[0] = fastRange(h.get<u64>(0), range);
+
+		auto words = bandWords();
+		for (u64 j = 0; j < words; j += 2)
+		{
+			h = mAes.hashBlock(h);
+			bands[j] = h.get<u64>(0);
+			if (j + 1 < words)
+				bands[j + 1] = h.get<u64>(1);
+		}
+		bands[0] |= 1;
+	}
+
+	std::vector<u64> BandOkvs::startOrder() const
+	{
+		// counting sort on the start column.
+		std::vector<u64> offsets(mSize + 1), order(mNumItems);
+		for (auto s : mStarts)
+			++offsets[s + 1];
+		for (u64 i = 0; i < mSize; ++i)
+			offsets[i + 1] += offsets[i];
+		for (u64 i = 0; i < mNumItems; ++i)
+			order[offsets[mStarts[i]]++] = i;
+		return order;
+	}
+
+	bool BandOkvs::avx2Rows()
+	{
+		static const bool has = __builtin_cpu_supports("avx2");
+		return has;
+	}
+
+	bool BandOkvs::avx512Rows()
+	{
+		static const bool has = __builtin_cpu_supports("avx512f");
+		return has;
+	}
+
+	void BandOkvs::setInput(span<const block> inputs)
+	{
+		setTimePoint("BandOkvs::setInput begin");
+		if (inputs.size() != mNumItems)
+			throw RTE_LOC;
+
+		auto words = bandWords();
+		mStarts.resize(mNumItems);
+		mBands.resize(mNumItems * words);
+
+		auto main = inputs.size() / 32 * 32;
+		u64 i = 0;
+		for (; i < main; i += 32)
+			hashBuildRow32(inputs.data() + i, mStarts.data() + i, mBands.data() + i * words);
+		for (; i < inputs.size(); ++i)
+			hashBuildRow1(inputs.data() + i, mStarts.data() + i, mBands.data() + i * words);
+
+		setTimePoint("BandOkvs::setInput end");
+	}
+}
@@ -0,0 +1,585 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <cstring>
+#include <iostream>
+
+#include "Defines.h"
+#include "Paxos.h"
+
+#include <cryptoTools/Common/Timer.h>
+#include <cryptoTools/Crypto/AES.h>
+#include <cryptoTools/Crypto/PRNG.h>
+
+#ifdef OC_ENABLE_SSE2
+#include <immintrin.h>
+#endif
+
+namespace volePSI
+{
+	// The parameters of the random band OKVS (RB-OKVS). Each key is mapped to a
+	// random start position and a random band of mBandWidth bits. The system is
+	// solved with banded gaussian elimination.
+	// See "Near-Optimal Oblivious Key-Value Stores for Efficient PSI, PSU and
+	// Volume-Hiding Multi-Maps", Bienstock et al., USENIX Security 2023.
+	struct BandParam
+	{
+		u64 mNumItems = 0,
+			mBandWidth = 512,
+			mSize = 0,
+			mSsp = 40;
+
+		// the relative over-provisioning of the columns, ie size ~ (1+eps) n.
+		double mEpsilon = 0;
+
+		BandParam() = default;
+		BandParam(const BandParam&) = default;
+		BandParam& operator=(const BandParam&) = default;
+
+		BandParam(u64 numItems, u64 bandWidth = 512, u64 ssp = 40)
+		{
+			init(numItems, bandWidth, ssp);
+		}
+
+		// computes the band parameters. bandWidth should be 64, 128, 256 or 512.
+		// epsilon is chosen such that encoding fails with probability ~2^-ssp,
+		// see BandOkvs.cpp for the measurements behind it.
+		void init(u64 numItems, u64 bandWidth = 512, u64 ssp = 40);
+
+		// computes the band parameters with an explicit over-provisioning epsilon.
+		void init(u64 numItems, u64 bandWidth, u64 ssp, double epsilon);
+
+		// the size of the okvs data structure.
+		u64 size() const
+		{
+			return mSize;
+		}
+
+		// the number of 64 bit words of a band.
+		u64 bandWords() const
+		{
+			return mBandWidth / 64;
+		}
+	};
+
+	// A random band OKVS. This has the same init/setInput/encode/decode
+	// surface as Paxos. With 512 bit bands the expansion is roughly 1.03-1.05
+	// at ssp=40, growing slowly with n. The trade off is that decoding touches
+	// ~mBandWidth/2 positions of the okvs instead of 3 + dense.
+	class BandOkvs : public BandParam, public oc::TimerAdapter
+	{
+	public:
+
+		// the encoding/decoding seed.
+		block mSeed;
+
+		// when decoding, add the decoded value to the
+		// output, as opposed to overwriting.
+		bool mAddToDecode = false;
+
+		// used to hash the keys to their rows.
+		oc::AES mAes;
+
+		// the start column of each row.
+		std::vector<u64> mStarts;
+
+		// the band of each row, bandWords() words per row. Bit j of word k
+		// denotes column mStarts[i] + 64 k + j.
+		std::vector<u64> mBands;
+
+		BandOkvs() = default;
+		BandOkvs(const BandOkvs&) = default;
+		BandOkvs(BandOkvs&&) = default;
+		BandOkvs& operator=(const BandOkvs&) = default;
+		BandOkvs& operator=(BandOkvs&&) = default;
+
+		// initialize the okvs with the given parameters.
+		void init(u64 numItems, u64 bandWidth, u64 ssp, block seed)
+		{
+			BandParam p(numItems, bandWidth, ssp);
+			init(numItems, p, seed);
+		}
+
+		// initialize the okvs with the given parameters.
+		void init(u64 numItems, BandParam p, block seed);
+
+		// set the input keys which define the okvs matrix. After that,
+		// encode can be called more than once.
+		void setInput(span<const block> inputs);
+		// solve/encode the given inputs,value pair.
+		template<typename ValueType>
+		void solve(span<const block> inputs, span<const ValueType> values, span<ValueType> output, oc::PRNG* prng = nullptr)
+		{
+			setInput(inputs);
+			encode<ValueType>(values, output, prng);
+		}
+
+		// encode the given values based on the already set input. output
+		// should be size() in size. If the okvs should be randomized, then
+		// provide a PRNG.
+		template<typename ValueType>
+		void encode(span<const ValueType> values, span<ValueType> output, oc::PRNG* prng = nullptr)
+		{
+			PxVector<const ValueType> V(values);
+			PxVector<ValueType> P(output);
+			auto h = P.defaultHelper();
+			encode(V, P, h, prng);
+		}
+
+		// encode the given values based on the already set input. values should
+		// have numItems rows, output should have size() rows. Both should have
+		// the same number of columns.
+		template<typename ValueType>
+		void encode(MatrixView<const ValueType> values, MatrixView<ValueType> output, oc::PRNG* prng = nullptr)
+		{
+			if (values.cols() != output.cols())
+				throw RTE_LOC;
+
+			if (values.cols() == 1)
+			{
+				encode(span<const ValueType>(values), span<ValueType>(output), prng);
+			}
+			else
+			{
+				PxMatrix<const ValueType> V(values);
+				PxMatrix<ValueType> P(output);
+				auto h = P.defaultHelper();
+				encode(V, P, h, prng);
+			}
+		}
+
+		// encode with the given PxVector/PxMatrix and helper.
+		template<typename Vec, typename ConstVec, typename Helper>
+		void encode(ConstVec& values, Vec& output, Helper& h, oc::PRNG* prng = nullptr);
+
+		// Decode the given input based on the okvs p. The
+		// output is written to values.
+		template<typename ValueType>
+		void decode(span<const block> input, span<ValueType> values, span<const ValueType> p)
+		{
+			PxVector<ValueType> V(values);
+			PxVector<const ValueType> P(p);
+			auto h = V.defaultHelper();
+			decode(input, V, P, h);
+		}
+
+		// Decode the given input based on the okvs p. values and p
+		// should have the same number of columns.
+		template<typename ValueType>
+		void decode(span<const block> input, MatrixView<ValueType> values, MatrixView<const ValueType> p)
+		{
+			if (values.cols() != p.cols())
+				throw RTE_LOC;
+
+			if (values.cols() == 1)
+			{
+				decode(input, span<ValueType>(values), span<const ValueType>(p));
+			}
+			else
+			{
+				PxMatrix<ValueType> V(values);
+				PxMatrix<const ValueType> P(p);
+				auto h = V.defaultHelper();
+				decode(input, V, P, h);
+			}
+		}
+
+		// decode with the given PxVector/PxMatrix and helper.
+		template<typename Helper, typename Vec, typename ConstVec>
+		void decode(span<const block> input, Vec& values, ConstVec& p, Helper& h);
+
+		// Decode the inputs that were passed to setInput() based on the okvs p,
+		// reusing their hashed rows. This lets the hashing run before p is
+		// available. values should have numItems rows.
+		template<typename ValueType>
+		void decodePrepared(MatrixView<ValueType> values, MatrixView<const ValueType> p)
+		{
+			if (values.cols() != p.cols())
+				throw RTE_LOC;
+
+			if (values.cols() == 1)
+			{
+				span<ValueType> v(values);
+				span<const ValueType> q(p);
+				PxVector<ValueType> V(v);
+				PxVector<const ValueType> P(q);
+				auto h = V.defaultHelper();
+				decodePrepared(V, P, h);
+			}
+			else
+			{
+				PxMatrix<ValueType> V(values);
+				PxMatrix<const ValueType> P(p);
+				auto h = V.defaultHelper();
+				decodePrepared(V, P, h);
+			}
+		}
+
+		// decodePrepared with the given PxVector/PxMatrix and helper.
+		template<typename Helper, typename Vec, typename ConstVec>
+		void decodePrepared(Vec& values, ConstVec& p, Helper& h);
+
+
+		////////////////////////////////////////
+		// private functions
+		////////////////////////////////////////
+
+		// hash 32 inputs to their start position and band.
+		void hashBuildRow32(const block* input, u64* starts, u64* bands) const;
+
+		// hash one input to its start position and band.
+		void hashBuildRow1(const block* input, u64* starts, u64* bands) const;
+
+		// the rows of setInput() ordered by their start column.
+		std::vector<u64> startOrder() const;
+
+		// whether the AVX2 / AVX-512 row operations can be used on this cpu.
+		static bool avx2Rows();
+		static bool avx512Rows();
+
+		// values = sum_j band_j * p[start + j]
+		template<typename Helper, typename Vec, typename ConstVec>
+		void decode1(u64 start, const u64* band, Vec& values, u64 i, ConstVec& p, Helper& h);
+	};
+
+	// A band of W words in general purpose registers. The elimination only
+	// needs to load, store and xor bands, find their lowest set bit and shift
+	// them down to it.
+	template<u64 W>
+	struct BandRow
+	{
+		static constexpr u64 Words = W;
+		std::array<u64, W> mW;
+
+		void load(const u64* p) { std::memcpy(mW.data(), p, sizeof(mW)); }
+		void store(u64* p) const { std::memcpy(p, mW.data(), sizeof(mW)); }
+
+		void xorWith(const u64* p)
+		{
+			for (u64 i = 0; i < W; ++i)
+				mW[i] ^= p[i];
+		}
+
+		// the index of the lowest set bit, ~0 if the band is zero.
+		u64 lead() const
+		{
+			for (u64 i = 0; i < W; ++i)
+				if (mW[i])
+					return i * 64 + __builtin_ctzll(mW[i]);
+			return ~0ull;
+		}
+
+		void shiftRight(u64 s)
+		{
+			auto ws = s / 64, bs = s % 64;
+			for (u64 i = 0; i < W; ++i)
+			{
+				auto lo = i + ws < W ? mW[i + ws] : 0;
+				auto hi = i + ws + 1 < W ? mW[i + ws + 1] : 0;
+				mW[i] = bs ? (lo >> bs) | (hi << (64 - bs)) : lo;
+			}
+		}
+	};
+
+#ifdef OC_ENABLE_SSE2
+#define BAND_AVX2_FN __attribute__((target("avx2")))
+#define BAND_AVX512_FN __attribute__((target("avx512f")))
+
+	// a 256 bit band in one AVX2 register.
+	struct BandRowAvx2
+	{
+		static constexpr u64 Words = 4;
+		__m256i mV;
+
+		BAND_AVX2_FN void load(const u64* p) { mV = _mm256_loadu_si256((const __m256i*)p); }
+		BAND_AVX2_FN void store(u64* p) const { _mm256_storeu_si256((__m256i*)p, mV); }
+		BAND_AVX2_FN void xorWith(const u64* p) { mV = _mm256_xor_si256(mV, _mm256_loadu_si256((const __m256i*)p)); }
+
+		BAND_AVX2_FN u64 lead() const
+		{
+			auto zero = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(mV, _mm256_setzero_si256())));
+			auto nonZero = ~zero & 0xF;
+			if (nonZero == 0)
+				return ~0ull;
+			alignas(32) std::array<u64, 4> w;
+			_mm256_store_si256((__m256i*)w.data(), mV);
+			auto i = __builtin_ctz(nonZero);
+			return i * 64 + __builtin_ctzll(w[i]);
+		}
+
+		// the next word of every lane, zero for the top lane.
+		BAND_AVX2_FN static __m256i nextWord(__m256i v)
+		{
+			return _mm256_blend_epi32(_mm256_permute4x64_epi64(v, _MM_SHUFFLE(3, 3, 2, 1)), _mm256_setzero_si256(), 0xC0);
+		}
+
+		BAND_AVX2_FN void shiftRight(u64 s)
+		{
+			for (; s >= 64; s -= 64)
+				mV = nextWord(mV);
+			if (s)
+				mV = _mm256_or_si256(
+					_mm256_srl_epi64(mV, _mm_cvtsi64_si128(s)),
+					_mm256_sll_epi64(nextWord(mV), _mm_cvtsi64_si128(64 - s)));
+		}
+	};
+
+	// a 512 bit band in one AVX-512 register.
+	struct BandRowAvx512
+	{
+		static constexpr u64 Words = 8;
+		__m512i mV;
+
+		BAND_AVX512_FN void load(const u64* p) { mV = _mm512_loadu_si512(p); }
+		BAND_AVX512_FN void store(u64* p) const { _mm512_storeu_si512(p, mV); }
+		BAND_AVX512_FN void xorWith(const u64* p) { mV = _mm512_xor_si512(mV, _mm512_loadu_si512(p)); }
+
+		BAND_AVX512_FN u64 lead() const
+		{
+			auto nonZero = _mm512_test_epi64_mask(mV, mV);
+			if (nonZero == 0)
+				return ~0ull;
+			alignas(64) std::array<u64, 8> w;
+			_mm512_store_si512(w.data(), mV);
+			auto i = __builtin_ctz(nonZero);
+			return i * 64 + __builtin_ctzll(w[i]);
+		}
+
+		BAND_AVX512_FN static __m512i nextWord(__m512i v)
+		{
+			return _mm512_maskz_alignr_epi64(0xFF, _mm512_setzero_si512(), v, 1);
+		}
+
+		BAND_AVX512_FN void shiftRight(u64 s)
+		{
+			for (; s >= 64; s -= 64)
+				mV = nextWord(mV);
+			if (s)
+				mV = _mm512_or_si512(
+					_mm512_maskz_srl_epi64(0xFF, mV, _mm_cvtsi64_si128(s)),
+					_mm512_maskz_sll_epi64(0xFF, nextWord(mV), _mm_cvtsi64_si128(64 - s)));
+		}
+	};
+#endif
+
+	// on-the-fly banded elimination of the rows in the given order. Each row is
+	// reduced by the pivots at its leading column until it finds a free column.
+	// Rows stay aligned to their leading bit so the band never grows. Returns
+	// the first linearly dependent row, or ~0 if every row got a pivot.
+	template<typename Row, typename Vec, typename ConstVec, typename Helper>
+	u64 bandEliminate(span<const u64> order, const u64* starts, const u64* bands,
+		ConstVec& values, Vec& output, Helper& h, u64* pivots)
+	{
+		constexpr u64 W = Row::Words;
+		auto v = h.newElement();
+		auto vPtr = h.asPtr(v);
+
+		for (u64 k = 0; k < order.size(); ++k)
+		{
+			if (k + 16 < order.size())
+				__builtin_prefetch(bands + order[k + 16] * W);
+
+			auto i = order[k];
+			auto col = starts[i];
+			Row band;
+			band.load(bands + i * W);
+			h.assign(vPtr, values[i]);
+
+			while (true)
+			{
+				auto shift = band.lead();
+				if (shift == ~0ull)
+					return i;
+				if (shift)
+				{
+					band.shiftRight(shift);
+					col += shift;
+				}
+
+				auto pivot = pivots + col * W;
+				if ((pivot[0] & 1) == 0)
+				{
+					band.store(pivot);
+					h.assign(output[col], vPtr);
+					break;
+				}
+
+				band.xorWith(pivot);
+				h.add(vPtr, output[col]);
+			}
+		}
+		return ~0ull;
+	}
+
+#ifdef OC_ENABLE_SSE2
+	// bandEliminate with the rows in vector registers. flatten inlines the
+	// row operations, which can not be inlined into a function without the
+	// target attribute.
+	template<typename Vec, typename ConstVec, typename Helper>
+	__attribute__((flatten)) BAND_AVX2_FN u64 bandEliminateAvx2(span<const u64> order, const u64* starts,
+		const u64* bands, ConstVec& values, Vec& output, Helper& h, u64* pivots)
+	{
+		return bandEliminate<BandRowAvx2>(order, starts, bands, values, output, h, pivots);
+	}
+
+	template<typename Vec, typename ConstVec, typename Helper>
+	__attribute__((flatten)) BAND_AVX512_FN u64 bandEliminateAvx512(span<const u64> order, const u64* starts,
+		const u64* bands, ConstVec& values, Vec& output, Helper& h, u64* pivots)
+	{
+		return bandEliminate<BandRowAvx512>(order, starts, bands, values, output, h, pivots);
+	}
+#endif
+
+	template<typename Vec, typename ConstVec, typename Helper>
+	void BandOkvs::encode(ConstVec& values, Vec& output, Helper& h, oc::PRNG* prng)
+	{
+		setTimePoint("BandOkvs::encode begin");
+		if (values.size() != mNumItems || output.size() != size())
+			throw RTE_LOC;
+		if (mStarts.size() != mNumItems)
+			throw RTE_LOC;
+
+		// the pivot row of each column, bandWords() words each. Pivot rows are
+		// stored shifted to their leading bit, so bit 0 of a pivot is set and a
+		// clear bit 0 denotes no pivot. The value of the pivot row is stored in output[col].
+		auto words = bandWords();
+		std::vector<u64> pivots(size() * words);
+		output.zerofill();
+
+		// rows are eliminated in the order of their start column, so consecutive
+		// rows work on neighbouring pivots instead of a random cache line each.
+		auto order = startOrder();
+		setTimePoint("BandOkvs::encode sort");
+
+		auto s = mStarts.data();
+		auto b = mBands.data();
+		auto pv = pivots.data();
+		u64 bad = ~0ull;
+		switch (words)
+		{
+		case 1:
+			bad = bandEliminate<BandRow<1>>(order, s, b, values, output, h, pv);
+			break;
+		case 2:
+			bad = bandEliminate<BandRow<2>>(order, s, b, values, output, h, pv);
+			break;
+		case 4:
+#ifdef OC_ENABLE_SSE2
+			if (avx2Rows())
+				bad = bandEliminateAvx2(order, s, b, values, output, h, pv);
+			else
+#endif
+				bad = bandEliminate<BandRow<4>>(order, s, b, values, output, h, pv);
+			break;
+		case 8:
+#ifdef OC_ENABLE_SSE2
+			if (avx512Rows())
+				bad = bandEliminateAvx512(order, s, b, values, output, h, pv);
+			else
+#endif
+				bad = bandEliminate<BandRow<8>>(order, s, b, values, output, h, pv);
+			break;
+		default:
+			throw RTE_LOC;
+		}
+
+		if (bad != ~0ull)
+		{
+			std::cout << "band okvs failed to encode, linearly dependent row " << bad
+				<< ". seed " << mSeed << " n " << mNumItems << " m " << size() << std::endl;
+			throw RTE_LOC;
+		}
+		setTimePoint("BandOkvs::encode eliminate");
+
+		// back substitution, right to left. Free columns are zero or random.
+		for (u64 col = size() - 1; col < size(); --col)
+		{
+			auto pivot = pivots.data() + col * words;
+			if ((pivot[0] & 1) == 0)
+			{
+				if (prng)
+					h.randomize(output[col], *prng);
+				continue;
+			}
+
+			for (u64 j = 0; j < words; ++j)
+			{
+				auto bits = pivot[j] ^ (j == 0);
+				while (bits)
+				{
+					h.add(output[col], output[col + 64 * j + __builtin_ctzll(bits)]);
+					bits &= bits - 1;
+				}
+			}
+		}
+		setTimePoint("BandOkvs::encode backfill");
+	}
+
+	template<typename Helper, typename Vec, typename ConstVec>
+	void BandOkvs::decode1(u64 start, const u64* band, Vec& values, u64 i, ConstVec& p, Helper& h)
+	{
+		auto dst = values[i];
+		auto src = p[start];
+
+		// bit 0 of every band is set.
+		if (mAddToDecode)
+			h.add(dst, src);
+		else
+			h.assign(dst, src);
+
+		for (u64 j = 0; j < bandWords(); ++j)
+		{
+			auto bits = band[j] ^ (j == 0);
+			auto col = start + 64 * j;
+			while (bits)
+			{
+				h.add(dst, p[col + __builtin_ctzll(bits)]);
+				bits &= bits - 1;
+			}
+		}
+	}
+
+	template<typename Helper, typename Vec, typename ConstVec>
+	void BandOkvs::decode(span<const block> inputs, Vec& values, ConstVec& p, Helper& h)
+	{
+		setTimePoint("BandOkvs::decode begin");
+		if (p.size() != size())
+			throw RTE_LOC;
+
+		constexpr u64 batchSize = 32;
+		auto words = bandWords();
+		std::array<u64, batchSize> starts;
+		std::vector<u64> bands(batchSize * words);
+
+		auto main = inputs.size() / batchSize * batchSize;
+		u64 i = 0;
+		for (; i < main; i += batchSize)
+		{
+			hashBuildRow32(inputs.data() + i, starts.data(), bands.data());
+			for (u64 k = 0; k < batchSize; ++k)
+				decode1(starts[k], bands.data() + k * words, values, i + k, p, h);
+		}
+
+		for (; i < inputs.size(); ++i)
+		{
+			hashBuildRow1(inputs.data() + i, starts.data(), bands.data());
+			decode1(starts[0], bands.data(), values, i, p, h);
+		}
+		setTimePoint("BandOkvs::decode done");
+	}
+
+	template<typename Helper, typename Vec, typename ConstVec>
+	void BandOkvs::decodePrepared(Vec& values, ConstVec& p, Helper& h)
+	{
+		setTimePoint("BandOkvs::decodePrepared begin");
+		if (p.size() != size() || values.size() != mNumItems)
+			throw RTE_LOC;
+		if (mStarts.size() != mNumItems)
+			throw RTE_LOC;
+
+		auto words = bandWords();
+		for (u64 i = 0; i < mNumItems; ++i)
+			decode1(mStarts[i], mBands.data() + i * words, values, i, p, h);
+		setTimePoint("BandOkvs::decodePrepared done");
+	}
+}
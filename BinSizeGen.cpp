@@ -0,0 +1,22 @@
+#include <fstream>
+#include <iostream>
+#include "SimpleIndex.h"
+
+// regenerates BinSizeTable.h, usage: ./binsize_gen [output path]
+// This is the same as ./perf -overflow -o <path>.
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        std::ofstream out(argv[1]);
+        if (!out)
+        {
+            std::cerr << "failed to open " << argv[1] << std::endl;
+            return 1;
+        }
+        volePSI::SimpleIndex::printBinSizeTable(out);
+    }
+    else
+        volePSI::SimpleIndex::printBinSizeTable(std::cout);
+    return 0;
+}
@@ -0,0 +1,298 @@
+#pragma once
+// Generated by SimpleIndex::printBinSizeTable (binsize_gen). Do not edit.
+//
+// gBinSizes[s][i][j] is the smallest bin size such that throwing gGridPoints[j]
+// balls into gGridPoints[i] bins overflows with probability at most 2^-gSsps[s].
+#include "Defines.h"
+
+namespace volePSI
+{
+    namespace binSizeTable
+    {
+        constexpr u64 gStepsPerDoubling = 2;
+        constexpr u64 gNumPoints = 81;
+        constexpr u64 gMaxPoint = 1099511627776;
+        constexpr u64 gNumSsps = 3;
+
+        constexpr u64 gSsps[gNumSsps]{ 40, 64, 80 };
+
+        // round(2^(i / gStepsPerDoubling))
+        constexpr u64 gGridPoints[gNumPoints]{
+            1, 1, 2, 3, 4, 6, 8, 11,
+            16, 23, 32, 45, 64, 91, 128, 181,
+            256, 362, 512, 724, 1024, 1448, 2048, 2896,
+            4096, 5793, 8192, 11585, 16384, 23170, 32768, 46341,
+            65536, 92682, 131072, 185364, 262144, 370728, 524288, 741455,
+            1048576, 1482910, 2097152, 2965821, 4194304, 5931642, 8388608, 11863283,
+            16777216, 23726566, 33554432, 47453133, 67108864, 94906266, 134217728, 189812531,
+            268435456, 379625062, 536870912, 759250125, 1073741824, 1518500250, 2147483648, 3037000500,
+            4294967296, 6074001000, 8589934592, 12148002000, 17179869184, 24296004000, 34359738368, 48592008000,
+            68719476736, 97184015999, 137438953472, 194368031998, 274877906944, 388736063997, 549755813888, 777472127994,
+            1099511627776,
+        };
+
+        constexpr u64 gBinSizes[gNumSsps][gNumPoints][gNumPoints]{
+            { // ssp 40
+                /*0*/ {1,1,2,3,4,6,8,11,16,23,32,45,64,91,128,181,256,362,512,724,1024,1448,2048,2896,4096,5793,8192,11585,16384,23170,32768,46341,65536,92682,131072,185364,262144,370728,524288,741455,1048576,1482910,2097152,2965821,4194304,5931642,8388608,11863283,16777216,23726566,33554432,47453133,67108864,94906266,134217728,189812531,268435456,379625062,536870912,759250125,1073741824,1518500250,2147483648,3037000500,4294967296,6074001000,8589934592,12148002000,17179869184,24296004000,34359738368,48592008000,68719476736,97184015999,137438953472,194368031998,274877906944,388736063997,549755813888,777472127994,1099511627776},
+                /*1*/ {1,1,2,3,4,6,8,11,16,23,32,45,64,91,128,181,256,362,512,724,1024,1448,2048,2896,4096,5793,8192,11585,16384,23170,32768,46341,65536,92682,131072,185364,262144,370728,524288,741455,1048576,1482910,2097152,2965821,4194304,5931642,8388608,11863283,16777216,23726566,33554432,47453133,67108864,94906266,134217728,189812531,268435456,379625062,536870912,759250125,1073741824,1518500250,2147483648,3037000500,4294967296,6074001000,8589934592,12148002000,17179869184,24296004000,34359738368,48592008000,68719476736,97184015999,137438953472,194368031998,274877906944,388736063997,549755813888,777472127994,1099511627776},
+                /*2*/ {1,1,2,3,4,6,8,11,16,23,32,44,58,78,103,137,184,248,336,458,626,860,1185,1640,2276,3168,4419,6177,8649,12129,17031,23940,33683,47429,66830,94220,132901,187540,264731,373804,527947,745806,1053750,1489064,2104470,2974523,4204653,5943948,8403243,11880687,16797913,23751180,33583702,47487942,67150259,94955492,134276269,189882148,268518245,379723516,536987994,759389360,1073907403,1518697158,2147717812,3037278970,4295298454,6074394815,8590402920,12148558939,17180531500,24296791631,34360675024,48593121878,68720801368,97185591261,137440826785,194370259755,274880556208,388739214521,549759560514},
+                /*3*/ {1,1,2,3,4,6,8,11,16,23,30,38,49,64,83,108,142,187,250,335,452,614,839,1151,1585,2192,3041,4230,5899,8243,11540,16181,22717,31930,44922,63252,89122,125646,177224,250078,353004,498440,703970,994456,1405057,1985485,2806038,3966123,5606313,7925394,11204479,15841100,22397435,31668497,44778576,63317618,89534109,126607835,179035634,253176921,358025187,506299043,715985206,1012520590,1431878253,2024931583,2863626175,4049708176,5727068034,8099197164,11453875408,16198084350,22907382188,32395730325,45814243058,64790840696,91627748863,129580804647,183254455095,259160369389,366507435686},
+                /*4*/ {1,1,2,3,4,6,8,11,16,22,27,34,44,55,70,91,117,154,203,269,360,485,658,897,1229,1691,2336,3238,4501,6274,8764,12264,17191,24129,33907,47695,67146,94595,133346,188068,265359,374550,528833,746859,1055001,1490551,2106237,2976624,4207150,5946918,8406774,11884885,16802905,23757115,33590759,47496333,67160237,94967358,134290379,189898927,268538198,379747243,537016209,759422912,1073947303,1518744606,2147774237,3037346070,4295378250,6074489708,8590515766,12148693136,17180691087,24296981412,34360900713,48593390267,68721120538,97185970819,137441278157,194370796530,274881194543},
+                /*5*/ {1,1,2,3,4,6,8,11,16,20,24,29,36,45,57,71,91,117,152,199,263,350,470,634,862,1178,1617,2229,3084,4281,5959,8314,11624,16280,22835,32070,45088,63449,89356,125923,177553,250468,353468,498992,704625,995234,1405982,1986584,2807345,3967677,5608160,7927590,11207089,15844204,22401125,31672886,44783794,63323823,89541488,126616609,179046067,253189328,358039941,506316588,716006070,1012545401,1431907758,2024966670,2863667900,4049757796,5727127041,8099267335,11453958855,16198183585,22907500199,32395870664,45814409950,64791039165,91627984883,129581085322,183254788876},
+                /*6*/ {1,1,2,3,4,6,8,11,15,18,22,26,32,39,49,61,76,97,125,162,212,279,372,499,674,915,1250,1716,2365,3272,4542,6321,8819,12330,17269,24221,34016,47824,67299,94777,133562,188324,265663,374911,529262,747369,1055608,1491271,2107093,2977642,4208361,5948357,8408484,11886919,16805323,23759990,33594178,47500398,67165070,94973106,134297213,189907054,268547862,379758736,537029876,759439165,1073966630,1518767590,2147801569,3037378573,4295416902,6074535673,8590570428,12148758139,17180768389,24297073340,34361010033,48593520272,68721275140,97186154672,137441496796},
+                /*7*/ {1,1,2,3,4,6,8,11,14,17,20,23,28,34,41,51,63,80,101,129,168,219,289,384,515,695,944,1288,1768,2436,3370,4676,6508,9078,12691,17771,24924,35001,49205,69238,97504,137400,193728,273279,385651,544412,768750,1085792,1533895,2167297,3062694,4328536,6118185,8648508,12226187,17284908,24437974,34552694,48855589,69081178,97682388,138128120,195324064,276207826,390590555,552347187,781099693,1104597554,1562084248,2209058185,3124005669,4417922737,6247781068,8835571636,12495236488,17670756011,24990012444,35340964356,49979373601,70681154197,99957826144},
+                /*8*/ {1,1,2,3,4,6,8,10,13,15,17,20,24,29,35,42,51,64,80,101,129,166,217,285,379,506,682,925,1262,1729,2381,3291,4564,6348,8851,12367,17312,24273,34077,47897,67385,94879,133683,188467,265833,375114,529502,747655,1055947,1491674,2107573,2978212,4209038,5949162,8409442,11888057,16806676,23761599,33596091,47502673,67167776,94976323,134301039,189911603,268553272,379765168,537037525,759448261,1073977448,1518780454,2147816867,3037396765,4295438536,6074561400,8590601022,12148794522,17180811655,24297124792,34361071221,48593593036,68721361671},
+                /*9*/ {1,1,2,3,4,6,8,10,12,14,16,18,21,25,29,35,42,52,64,80,101,129,166,216,284,376,502,676,916,1248,1709,2351,3248,4502,6259,8724,12186,17055,23907,33558,47159,66339,93396,131582,185491,261618,369145,521053,735696,1039023,1467726,2073688,2930271,4141216,5853220,8273726,11696088,16535143,23377538,33052882,46734380,66081153,93439495,132127505,186837607,264205798,373616691,528342002,747150622,1056585588,1494184208,2113031997,2988202904,4225867168,5976171744,8451455985,11952012473,16902518327,23903556825,33804479961,47806451629},
+                /*10*/ {1,1,2,3,4,6,8,9,11,12,14,16,19,22,26,30,36,44,53,65,82,103,131,169,220,289,383,511,688,932,1269,1738,2391,3303,4578,6364,8870,12390,17340,24305,34116,47942,67439,94943,133759,188558,265941,375241,529654,747835,1056161,1491929,2107876,2978572,4209466,5949670,8410046,11888776,16807531,23762615,33597300,47504110,67169485,94978355,134303456,189914478,268556690,379769233,537042359,759454009,1073984283,1518788582,2147826533,3037408259,4295452204,6074577655,8590620353,12148817510,17180838992,24297157301,34361109881},
+                /*11*/ {1,1,2,3,4,6,8,9,10,11,13,15,17,19,22,26,31,37,44,54,66,83,104,133,171,222,291,386,515,693,939,1278,1750,2408,3325,4608,6405,8926,12467,17445,24452,34320,48226,67836,95498,134538,189651,267477,377402,532695,752120,1062201,1500448,2119896,2995539,4233422,5983504,8457839,11956301,16902948,23897463,33787895,47773522,67550336,95516777,135064680,190990752,270078464,381920979,540084952,763756367,1080068119,1527391692,2159992295,3054612208,4319781028,6108982340,8639274181,12217622338,17278141247,24434760536},
+                /*12*/ {1,1,2,3,4,6,7,8,9,11,12,13,15,17,20,23,26,31,37,45,54,67,83,104,133,171,222,291,386,514,692,936,1274,1744,2399,3312,4588,6376,8884,12407,17359,24329,34143,47975,67477,94989,133814,188623,266018,375332,529762,747964,1056314,1492111,2108092,2978828,4209771,5950033,8410478,11889289,16808141,23763341,33598163,47505136,67170705,94979805,134305180,189916528,268559128,379772133,537045807,759458110,1073989159,1518794381,2147833429,3037416460,4295461957,6074589253,8590634145,12148833911,17180858497},
+                /*13*/ {1,1,2,3,4,6,7,8,9,10,11,12,14,15,17,20,23,27,31,37,45,54,67,83,105,133,171,222,291,385,514,690,934,1271,1738,2390,3298,4569,6348,8844,12349,17277,24210,33975,47735,67135,94503,133123,187642,264627,373361,526968,744005,1050708,1484172,2096853,2962921,4187258,5918175,8365401,11825513,16717914,23635702,33417608,47249738,66809451,94468838,133582470,188894351,267113421,377727437,534153986,755368236,1068204942,1510613950,2136264182,3021054633,4272322314,6041864231,8544353234,12083381936},
+                /*14*/ {1,1,2,3,4,6,7,7,8,9,10,11,12,14,16,18,20,23,27,32,38,45,55,68,84,106,134,172,224,293,388,517,695,940,1279,1749,2404,3318,4596,6386,8895,12420,17375,24347,34165,48001,67508,95025,133857,188674,266079,375405,529849,748066,1056436,1492256,2108264,2979033,4210014,5950323,8410822,11889698,16808627,23763919,33598850,47505953,67171677,94980961,134306555,189918163,268561072,379774444,537048556,759461378,1073993046,1518799003,2147838926,3037422997,4295469731,6074598497,8590645138},
+                /*15*/ {1,1,2,3,4,6,6,7,8,8,9,10,11,13,14,16,18,20,23,27,32,38,46,55,68,84,106,135,173,225,294,389,518,696,941,1281,1752,2407,3322,4600,6390,8901,12427,17384,24358,34179,48017,67529,95052,133890,188717,266134,375477,529943,748191,1056603,1492479,2108565,2979442,4210572,5951086,8411872,11891149,16810638,23766713,33602743,47511390,67179282,94991619,134321510,189939174,268590621,379816037,537107143,759543956,1074109498,1518963298,2148070807,3037750371,4295932047,6075251526},
+                /*16*/ {1,1,2,3,4,5,6,7,7,8,9,9,10,11,13,14,16,18,21,24,28,32,38,46,56,68,85,107,135,174,225,295,390,519,697,943,1282,1753,2409,3324,4603,6394,8905,12431,17388,24363,34184,48023,67535,95057,133895,188719,266132,375468,529923,748155,1056542,1492381,2108413,2979211,4210226,5950574,8411120,11890053,16809049,23764421,33599447,47506663,67172521,94981965,134307748,189919582,268562759,379776451,537050942,759464216,1073996421,1518803016,2147843698,3037428672,4295476480},
+                /*17*/ {1,1,2,3,4,5,6,6,7,7,8,9,10,11,12,13,14,16,18,21,24,28,33,39,46,56,69,85,107,136,174,226,296,391,520,699,944,1284,1756,2412,3327,4607,6398,8910,12438,17396,24373,34197,48039,67554,95082,133926,188759,266185,375537,530015,748276,1056703,1492599,2108707,2979611,4210773,5951326,8412157,11891488,16811040,23767192,33603312,47512066,67180087,94992576,134322648,189940527,268592230,379817950,537109419,759546662,1074112716,1518967125,2148075358,3037755783},
+                /*18*/ {1,1,2,3,4,5,5,6,6,7,8,8,9,10,11,12,13,14,16,18,21,24,28,33,39,47,56,69,86,107,136,175,227,296,392,521,700,946,1286,1757,2414,3330,4609,6401,8914,12442,17401,24378,34202,48044,67559,95086,133929,188760,266180,375526,529992,748237,1056639,1492497,2108550,2979374,4210420,5950805,8411395,11890379,16809437,23764882,33599995,47507315,67173296,94982887,134308845,189920886,268564310,379778295,537053135,759466824,1073999523,1518806705,2147848085},
+                /*19*/ {1,1,2,3,4,5,5,6,6,7,7,8,8,9,10,11,12,13,15,16,19,21,24,28,33,39,47,57,69,86,108,137,175,227,297,392,522,701,947,1287,1759,2416,3332,4613,6405,8919,12448,17408,24387,34214,48059,67578,95110,133960,188799,266232,375594,530082,748356,1056798,1492711,2108841,2979770,4210962,5951550,8412424,11891805,16811417,23767640,33603846,47512701,67180841,94993472,134323714,189941795,268593738,379819743,537111551,759549198,1074115731,1518970711},
+                /*20*/ {1,1,2,3,4,5,5,5,6,6,7,7,8,8,9,10,11,12,13,15,17,19,21,24,28,33,39,47,57,70,86,108,137,176,228,298,393,523,702,948,1289,1761,2418,3335,4615,6408,8922,12452,17412,24392,34218,48064,67583,95114,133962,188799,266227,375581,530058,748315,1056731,1492607,2108681,2979529,4210604,5951024,8411656,11890690,16809806,23765321,33600517,47507936,67174034,94983764,134309888,189922126,268565785,379780049,537055221,759469305,1074002472},
+                /*21*/ {1,1,2,3,4,5,5,5,6,6,6,7,7,8,9,9,10,11,12,13,15,17,19,21,25,29,33,40,47,57,70,87,109,138,176,228,299,394,524,703,950,1290,1763,2420,3337,4619,6412,8927,12458,17420,24401,34230,48078,67601,95137,133992,188838,266278,375648,530146,748432,1056889,1492819,2108969,2979922,4211143,5951766,8412680,11892110,16811780,23768071,33604358,47513310,67181566,94994334,134324739,189943014,268595188,379821467,537113601,759551635},
+                /*22*/ {1,1,2,3,4,4,5,5,5,6,6,6,7,7,8,9,9,10,11,12,13,15,17,19,22,25,29,34,40,48,57,70,87,109,138,177,229,299,395,525,704,951,1292,1765,2422,3340,4621,6415,8930,12461,17424,24405,34234,48083,67605,95141,133994,188836,266272,375634,530121,748390,1056821,1492713,2108808,2979680,4210783,5951237,8411909,11890990,16810164,23765746,33601023,47508537,67174749,94984614,134310899,189923328,268567215,379781749,537057242},
+                /*23*/ {1,1,2,3,4,4,4,5,5,5,6,6,7,7,7,8,9,9,10,11,12,14,15,17,19,22,25,29,34,40,48,58,71,87,109,139,177,230,300,396,526,705,952,1293,1766,2425,3342,4624,6419,8935,12467,17431,24414,34246,48097,67623,95164,134024,188875,266322,375700,530209,748507,1056977,1492924,2109094,2980071,4211320,5951976,8412930,11892407,16812133,23768492,33604858,47513904,67182273,94995175,134325739,189944203,268596601,379823148},
+                /*24*/ {1,1,2,3,4,4,4,5,5,5,5,6,6,7,7,8,8,9,9,10,11,12,14,15,17,19,22,25,29,34,40,48,58,71,88,110,139,178,230,301,396,527,706,953,1295,1768,2426,3344,4627,6422,8938,12471,17435,24418,34250,48101,67627,95167,134025,188873,266316,375687,530183,748464,1056909,1492817,2108931,2979827,4210958,5951445,8412156,11891285,16810514,23766162,33601518,47509125,67175448,94985446,134311888,189924505,268568614},
+                /*25*/ {1,1,2,3,4,4,4,4,5,5,5,6,6,6,7,7,8,8,9,10,10,11,12,14,15,17,19,22,25,29,34,40,48,58,71,88,110,140,178,231,301,397,528,707,955,1296,1770,2428,3347,4629,6425,8942,12475,17439,24423,34255,48107,67634,95174,134032,188879,266320,375688,530179,748451,1056883,1492771,2108854,2979704,4210768,5951157,8411726,11890649,16809581,23764805,33599552,47506291,67171376,94979609,134303541,189912591},
+                /*26*/ {1,1,2,3,4,4,4,4,5,5,5,5,6,6,6,7,7,8,8,9,10,10,11,13,14,15,17,19,22,25,29,34,41,48,59,72,88,111,140,179,231,302,398,529,709,956,1298,1771,2430,3349,4632,6428,8946,12480,17446,24431,34265,48119,67649,95193,134056,188910,266359,375738,530244,748536,1056995,1492920,2109053,2979972,4211131,5951650,8412400,11891575,16810858,23766572,33602005,47509705,67176138,94986266,134312863},
+                /*27*/ {1,1,2,3,3,4,4,4,4,5,5,5,5,6,6,6,7,7,8,8,9,10,11,12,13,14,16,17,20,22,26,30,35,41,49,59,72,89,111,140,179,232,303,399,530,710,957,1299,1773,2433,3352,4635,6432,8950,12485,17452,24438,34274,48130,67661,95207,134074,188932,266386,375771,530285,748588,1057059,1493001,2109157,2980105,4211302,5951873,8412693,11891962,16811373,23767262,33602934,47510965,67177855,94988618},
+                /*28*/ {1,1,2,3,3,4,4,4,4,4,5,5,5,5,6,6,6,7,7,8,8,9,10,11,12,13,14,16,18,20,22,26,30,35,41,49,59,72,89,111,141,180,233,303,400,531,711,958,1300,1775,2434,3354,4638,6435,8954,12489,17457,24444,34281,48138,67670,95218,134086,188946,266402,375789,530305,748608,1057080,1493021,2109174,2980115,4211301,5951852,8412641,11891861,16811199,23766977,33602486,47510277,67176818},
+                /*29*/ {1,1,2,3,3,4,4,4,4,4,4,5,5,5,5,6,6,7,7,7,8,8,9,10,11,12,13,14,16,18,20,23,26,30,35,41,49,59,72,89,112,141,180,233,304,400,532,712,959,1302,1777,2436,3356,4641,6438,8958,12494,17463,24451,34289,48148,67682,95233,134104,188968,266428,375822,530345,748659,1057144,1493102,2109277,2980247,4211472,5952075,8412932,11892246,16811712,23767664,33603413,47511534},
+                /*30*/ {1,1,2,3,3,3,4,4,4,4,4,5,5,5,5,6,6,6,7,7,7,8,9,9,10,11,12,13,14,16,18,20,23,26,30,35,41,49,60,73,90,112,142,181,234,305,401,533,713,961,1303,1778,2438,3358,4643,6442,8962,12498,17468,24457,34296,48155,67692,95243,134116,188981,266444,375839,530364,748679,1057164,1493122,2109293,2980257,4211469,5952053,8412879,11892144,16811535,23767377,33602962},
+                /*31*/ {1,1,2,3,3,3,3,4,4,4,4,4,5,5,5,5,6,6,6,7,7,8,8,9,9,10,11,12,13,14,16,18,20,23,26,30,35,42,50,60,73,90,113,142,181,234,305,402,533,714,962,1305,1780,2440,3361,4646,6445,8965,12503,17473,24463,34303,48164,67702,95256,134131,188999,266465,375863,530393,748713,1057205,1493170,2109350,2980324,4211548,5952145,8412988,11892271,16811684,23767550},
+                /*32*/ {1,1,2,3,3,3,3,4,4,4,4,4,4,5,5,5,5,6,6,6,7,7,8,8,9,9,10,11,12,13,15,16,18,20,23,26,30,35,42,50,60,73,90,113,143,182,235,306,403,534,715,963,1306,1782,2442,3363,4649,6448,8969,12507,17478,24469,34311,48173,67713,95268,134146,189017,266486,375889,530423,748749,1057248,1493221,2109411,2980397,4211636,5952251,8413114,11892424,16811868},
+                /*33*/ {1,1,2,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,6,6,6,7,7,8,8,9,9,10,11,12,13,15,16,18,20,23,26,31,36,42,50,60,74,91,113,143,182,235,307,403,535,716,964,1308,1783,2444,3365,4652,6451,8973,12512,17483,24476,34318,48182,67723,95281,134160,189034,266506,375913,530452,748783,1057288,1493268,2109467,2980463,4211714,5952343,8413222,11892550},
+                /*34*/ {1,1,2,3,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,6,6,6,7,7,8,8,9,10,10,11,12,13,15,16,18,21,23,27,31,36,42,50,61,74,91,114,143,183,236,307,404,536,717,965,1309,1785,2446,3368,4654,6454,8977,12516,17489,24482,34325,48191,67734,95293,134175,189052,266527,375938,530482,748819,1057331,1493319,2109528,2980536,4211801,5952447,8413348},
+                /*35*/ {1,1,2,3,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,8,8,9,10,10,11,12,13,15,16,18,21,23,27,31,36,42,51,61,74,91,114,144,183,236,308,405,537,718,967,1310,1786,2448,3370,4657,6457,8980,12520,17494,24488,34333,48199,67744,95305,134189,189069,266548,375962,530510,748852,1057370,1493366,2109584,2980602,4211878,5952538},
+                /*36*/ {1,1,2,3,3,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,6,6,6,7,7,7,8,8,9,10,10,11,12,14,15,17,18,21,24,27,31,36,43,51,61,74,92,114,144,184,237,309,406,538,719,968,1312,1788,2450,3372,4660,6461,8984,12525,17499,24494,34340,48208,67754,95318,134204,189086,266568,375987,530540,748888,1057412,1493416,2109643,2980673,4211965},
+                /*37*/ {1,1,2,3,3,3,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,6,6,6,7,7,7,8,8,9,10,11,11,12,14,15,17,19,21,24,27,31,36,43,51,61,75,92,115,145,184,238,309,406,539,720,969,1313,1790,2452,3374,4662,6464,8988,12529,17504,24500,34347,48217,67764,95330,134218,189103,266588,376011,530568,748921,1057452,1493463,2109699,2980739},
+                /*38*/ {1,1,2,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,6,6,6,7,7,7,8,8,9,10,11,11,13,14,15,17,19,21,24,27,31,37,43,51,62,75,92,115,145,185,238,310,407,539,721,970,1314,1791,2454,3377,4665,6467,8991,12534,17509,24507,34355,48225,67775,95342,134233,189120,266609,376035,530597,748956,1057494,1493513,2109758},
+                /*39*/ {1,1,2,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,8,8,9,9,10,11,12,13,14,15,17,19,21,24,27,32,37,43,51,62,75,93,115,145,185,239,310,408,540,722,971,1316,1793,2456,3379,4667,6470,8995,12538,17515,24513,34362,48234,67785,95354,134247,189137,266629,376059,530626,748990,1057534,1493561},
+                /*40*/ {1,1,2,2,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,8,8,9,9,10,11,12,13,14,15,17,19,21,24,28,32,37,43,52,62,76,93,116,146,186,239,311,409,541,723,973,1317,1794,2458,3381,4670,6473,8999,12542,17520,24519,34369,48242,67795,95366,134261,189154,266649,376083,530654,749024,1057574},
+                /*41*/ {1,1,2,2,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,8,8,9,9,10,11,12,13,14,15,17,19,21,24,28,32,37,44,52,62,76,93,116,146,186,240,312,409,542,724,974,1319,1796,2459,3383,4673,6476,9002,12547,17525,24525,34376,48251,67805,95378,134276,189171,266669,376107,530683,749057},
+                /*42*/ {1,1,2,2,2,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,6,6,6,6,7,7,8,8,9,9,10,11,12,13,14,16,17,19,22,24,28,32,37,44,52,63,76,94,117,147,187,240,312,410,543,725,975,1320,1798,2461,3385,4675,6479,9006,12551,17530,24531,34383,48259,67815,95390,134290,189188,266689,376130,530711},
+                /*43*/ {1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,6,6,6,7,7,7,8,8,9,9,10,11,12,13,14,16,17,19,22,25,28,32,38,44,52,63,76,94,117,147,187,241,313,411,544,726,976,1321,1799,2463,3388,4678,6482,9010,12555,17535,24537,34390,48268,67825,95402,134304,189205,266709,376154},
+                /*44*/ {1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,7,8,8,9,10,10,11,12,13,14,16,17,19,22,25,28,32,38,44,53,63,77,94,117,148,188,241,314,411,545,727,977,1323,1801,2465,3390,4680,6485,9013,12559,17540,24543,34397,48276,67835,95413,134318,189221,266729},
+                /*45*/ {1,1,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,7,8,8,9,10,10,11,12,13,14,16,18,20,22,25,28,33,38,44,53,63,77,95,118,148,188,242,314,412,545,728,978,1324,1802,2467,3392,4683,6488,9017,12564,17545,24549,34404,48285,67845,95425,134332,189238},
+                /*46*/ {1,1,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,7,8,8,9,10,10,11,12,13,14,16,18,20,22,25,28,33,38,45,53,64,77,95,118,148,189,242,315,413,546,729,979,1325,1804,2469,3394,4686,6491,9020,12568,17550,24555,34411,48293,67855,95437,134346},
+                /*47*/ {1,1,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,6,6,6,6,7,7,8,8,8,9,10,10,11,12,13,15,16,18,20,22,25,29,33,38,45,53,64,78,95,118,149,189,243,315,414,547,730,981,1327,1805,2470,3396,4688,6494,9024,12572,17555,24560,34418,48301,67865,95449},
+                /*48*/ {1,1,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,6,6,6,6,7,7,8,8,9,9,10,11,11,12,13,15,16,18,20,22,25,29,33,38,45,53,64,78,96,119,149,190,244,316,414,548,731,982,1328,1807,2472,3398,4691,6497,9027,12576,17560,24566,34425,48309,67874},
+                /*49*/ {1,1,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,8,8,9,9,10,11,11,12,13,15,16,18,20,22,25,29,33,39,45,54,64,78,96,119,150,190,244,317,415,549,732,983,1329,1809,2474,3401,4693,6500,9031,12580,17565,24572,34432,48318},
+                /*50*/ {1,1,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,7,8,8,9,9,10,11,11,12,14,15,16,18,20,23,25,29,33,39,45,54,65,78,96,119,150,190,245,317,416,550,733,984,1330,1810,2476,3403,4696,6503,9034,12584,17570,24578,34439},
+                /*51*/ {1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,7,8,8,9,9,10,11,12,13,14,15,16,18,20,23,26,29,34,39,46,54,65,79,97,120,150,191,245,318,416,550,734,985,1332,1812,2478,3405,4698,6506,9038,12589,17575,24584},
+                /*52*/ {1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,7,8,8,9,9,10,11,12,13,14,15,16,18,20,23,26,29,34,39,46,54,65,79,97,120,151,191,246,319,417,551,734,986,1333,1813,2480,3407,4701,6509,9041,12593,17580},
+                /*53*/ {1,1,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,11,12,13,14,15,17,18,20,23,26,29,34,39,46,55,65,79,97,120,151,192,246,319,418,552,735,987,1334,1815,2481,3409,4703,6512,9045,12597},
+                /*54*/ {1,1,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,10,10,11,12,13,14,15,17,18,21,23,26,30,34,39,46,55,66,80,97,121,152,192,247,320,419,553,736,988,1336,1816,2483,3411,4706,6515,9048},
+                /*55*/ {1,1,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,8,8,8,9,10,10,11,12,13,14,15,17,19,21,23,26,30,34,40,46,55,66,80,98,121,152,193,247,320,419,554,737,989,1337,1818,2485,3413,4708,6518},
+                /*56*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,8,8,9,9,10,10,11,12,13,14,15,17,19,21,23,26,30,34,40,47,55,66,80,98,122,152,193,248,321,420,554,738,991,1338,1819,2487,3415,4711},
+                /*57*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,7,8,8,9,9,10,10,11,12,13,14,15,17,19,21,23,26,30,34,40,47,55,66,80,98,122,153,194,248,322,421,555,739,992,1340,1821,2488,3417},
+                /*58*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,7,7,7,8,8,9,9,10,10,11,12,13,14,16,17,19,21,24,27,30,35,40,47,56,67,81,99,122,153,194,249,322,421,556,740,993,1341,1822,2490},
+                /*59*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,11,11,12,13,14,16,17,19,21,24,27,30,35,40,47,56,67,81,99,123,154,195,249,323,422,557,741,994,1342,1824},
+                /*60*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,11,11,12,13,14,16,17,19,21,24,27,30,35,41,47,56,67,81,99,123,154,195,250,323,423,558,742,995,1343},
+                /*61*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,11,11,12,13,14,16,17,19,21,24,27,31,35,41,48,56,67,81,100,123,154,195,250,324,423,558,743,996},
+                /*62*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,11,12,12,13,15,16,17,19,21,24,27,31,35,41,48,57,68,82,100,124,155,196,251,324,424,559,744},
+                /*63*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,8,8,8,9,9,10,11,12,12,13,15,16,18,19,22,24,27,31,35,41,48,57,68,82,100,124,155,196,251,325,425,560},
+                /*64*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,7,7,7,8,8,8,9,10,10,11,12,13,14,15,16,18,19,22,24,27,31,36,41,48,57,68,82,100,124,155,197,252,326,425},
+                /*65*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,10,11,12,13,14,15,16,18,20,22,24,27,31,36,41,48,57,68,82,101,125,156,197,252,326},
+                /*66*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,10,11,12,13,14,15,16,18,20,22,24,28,31,36,42,49,57,68,83,101,125,156,198,253},
+                /*67*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,10,11,12,13,14,15,16,18,20,22,25,28,31,36,42,49,58,69,83,101,125,157,198},
+                /*68*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,10,11,12,13,14,15,16,18,20,22,25,28,32,36,42,49,58,69,83,102,126,157},
+                /*69*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,10,11,12,13,14,15,17,18,20,22,25,28,32,36,42,49,58,69,84,102,126},
+                /*70*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,11,11,12,13,14,15,17,18,20,22,25,28,32,37,42,49,58,69,84,102},
+                /*71*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,11,11,12,13,14,15,17,18,20,22,25,28,32,37,42,49,58,70,84},
+                /*72*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,11,11,12,13,14,15,17,18,20,23,25,28,32,37,43,50,59,70},
+                /*73*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,11,11,12,13,14,15,17,19,20,23,25,28,32,37,43,50,59},
+                /*74*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,10,11,12,12,13,14,16,17,19,21,23,25,29,32,37,43,50},
+                /*75*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,10,11,12,12,13,14,16,17,19,21,23,26,29,33,37,43},
+                /*76*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,10,11,12,12,13,15,16,17,19,21,23,26,29,33,37},
+                /*77*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,9,9,10,10,11,12,13,13,15,16,17,19,21,23,26,29,33},
+                /*78*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,9,9,10,10,11,12,13,14,15,16,17,19,21,23,26,29},
+                /*79*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,12,13,14,15,16,17,19,21,23,26},
+                /*80*/ {1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,12,13,14,15,16,18,19,21,23},
+            },
+            { // ssp 64
+                /*0*/ {1,1,2,3,4,6,8,11,16,23,32,45,64,91,128,181,256,362,512,724,1024,1448,2048,2896,4096,5793,8192,11585,16384,23170,32768,46341,65536,92682,131072,185364,262144,370728,524288,741455,1048576,1482910,2097152,2965821,4194304,5931642,8388608,11863283,16777216,23726566,33554432,47453133,67108864,94906266,134217728,189812531,268435456,379625062,536870912,759250125,1073741824,1518500250,2147483648,3037000500,4294967296,6074001000,8589934592,12148002000,17179869184,24296004000,34359738368,48592008000,68719476736,97184015999,137438953472,194368031998,274877906944,388736063997,549755813888,777472127994,1099511627776},
+                /*1*/ {1,1,2,3,4,6,8,11,16,23,32,45,64,91,128,181,256,362,512,724,1024,1448,2048,2896,4096,5793,8192,11585,16384,23170,32768,46341,65536,92682,131072,185364,262144,370728,524288,741455,1048576,1482910,2097152,2965821,4194304,5931642,8388608,11863283,16777216,23726566,33554432,47453133,67108864,94906266,134217728,189812531,268435456,379625062,536870912,759250125,1073741824,1518500250,2147483648,3037000500,4294967296,6074001000,8589934592,12148002000,17179869184,24296004000,34359738368,48592008000,68719476736,97184015999,137438953472,194368031998,274877906944,388736063997,549755813888,777472127994,1099511627776},
+                /*2*/ {1,1,2,3,4,6,8,11,16,23,32,45,64,85,113,150,199,266,358,484,657,897,1230,1694,2341,3245,4510,6285,8778,12282,17213,24156,33940,47735,67193,94653,133416,188152,265459,374670,528976,747030,1055206,1490795,2106528,2976971,4207564,5947410,8407361,11885584,16803736,23758104,33591937,47497734,67161904,94969341,134292738,189901734,268541537,379751214,537020933,759428531,1073953985,1518752554,2147783690,3037357312,4295391619,6074505608,8590534675,12148715623,17180717830,24297013216,34360938535,48593435246,68721174028,97186034431,137441353805,194370886492,274881301528,388740100860,549760614555},
+                /*3*/ {1,1,2,3,4,6,8,11,16,23,32,44,57,73,94,121,157,206,272,361,484,651,883,1203,1647,2265,3127,4333,6021,8388,11712,16385,22960,32219,45265,63660,89606,126221,177908,250891,353971,499589,705336,996081,1406988,1987781,2808769,3969370,5610174,7929986,11209938,15847592,22405155,31677678,44789493,63330600,89549548,126626194,179057466,253202884,358056061,506335759,716028869,1012572513,1431940001,2025005014,2863713498,4049812022,5727191527,8099344023,11454050053,16198292039,22907629173,32396024041,45814592347,64791256073,91628242832,129581392078,183255153671,259161200141,366508423622},
+                /*4*/ {1,1,2,3,4,6,8,11,16,23,32,40,51,65,82,104,133,172,224,294,390,520,699,945,1286,1759,2416,3333,4614,6408,8922,12453,17414,24394,34222,48069,67589,95123,133973,188813,266244,375602,530083,748346,1056769,1492653,2108736,2979595,4210683,5951119,8411769,11890825,16809968,23765514,33600747,47508210,67174361,94984153,134310351,189922678,268566442,379780831,537056151,759470412,1074003789,1518811780,2147854120,3037441066,4295491219,6074624052,8590675529,12148883126,17180917024,24297250097,34361220234,48593770244,68721572409,97186508187,137441917198,194371556481,274882098282},
+                /*5*/ {1,1,2,3,4,6,8,11,16,23,29,36,44,54,67,84,105,134,172,222,290,381,506,677,913,1238,1687,2312,3182,4397,6096,8477,11817,16509,23106,32391,45470,63902,89893,126561,178311,251370,354540,500265,706139,997034,1408121,1989128,2810369,3971273,5612436,7932674,11213135,15851392,22409673,31683050,44795881,63338197,89558580,126636935,179070238,253218071,358074122,506357236,716054408,1012602883,1431976116,2025047962,2863764571,4049872757,5727263754,8099429914,11454152195,16198413505,22907773621,32396195819,45814796625,64791499001,91628531723,129581735627,183255562222},
+                /*6*/ {1,1,2,3,4,6,8,11,16,22,27,33,40,48,59,72,90,113,143,183,236,308,405,538,719,969,1313,1790,2452,3375,4664,6466,8990,12533,17509,24506,34354,48225,67775,95342,134234,189122,266611,376038,530601,748961,1057500,1493520,2109767,2980821,4212141,5952851,8413828,11893273,16812878,23768974,33604862,47513102,67180178,94991071,134318577,189932459,268578073,379794662,537072599,759489970,1074027048,1518839438,2147887011,3037480180,4295537733,6074679366,8590741307,12148961350,17181010048,24297360721,34361351788,48593926688,68721758452,97186729431,137442180302},
+                /*7*/ {1,1,2,3,4,6,8,11,16,21,25,30,35,42,51,62,76,94,117,148,190,244,319,419,555,742,999,1353,1844,2526,3476,4802,6657,9255,12899,18019,25217,35349,49618,69728,98086,138091,194550,274255,386810,545790,770388,1087739,1536210,2170049,3065966,4332427,6122811,8654008,12232726,17292684,24447221,34563690,48868664,69096726,97700877,138150106,195350210,276238918,390627529,552391156,781151980,1104659733,1562158191,2209146118,3124110238,4418047090,6247928949,8835747496,12495445621,17671004713,24990308201,35341316072,49979791862,70681651596,99958417653},
+                /*8*/ {1,1,2,3,4,6,8,11,16,19,22,26,31,37,43,52,63,76,94,117,148,188,242,315,413,547,730,981,1327,1806,2471,3397,4690,6496,9026,12575,17559,24565,34424,48308,67873,95459,134372,189286,266806,376269,530876,749287,1057887,1493981,2110315,2981472,4212914,5953770,8414921,11894572,16814423,23770810,33607045,47515698,67183264,94994741,134322941,189937649,268584244,379802000,537081325,759500347,1074039388,1518854113,2147904462,3037500932,4295562411,6074708713,8590776207,12149002852,17181059402,24297419413,34361421585,48594009690,68721857158},
+                /*9*/ {1,1,2,3,4,6,8,11,15,18,20,24,27,32,37,44,53,63,77,95,118,148,188,242,313,411,543,723,971,1313,1785,2441,3354,4627,6407,8899,12394,17301,24199,33904,47570,66826,93975,132269,186307,262588,370297,522422,737323,1040957,1470025,2076421,2933521,4145080,5857814,8279189,11702583,16542866,23386722,33063802,46747366,66096594,93457857,132149340,186863572,264236675,373653410,528385667,747202548,1056647337,1494257640,2113119322,2988306751,4225990662,5976318603,8451630630,11952220161,16902765310,23903850538,33804829246,47806867000},
+                /*10*/ {1,1,2,3,4,6,8,11,14,17,19,21,25,28,33,38,45,54,65,79,97,120,151,192,246,319,418,552,736,988,1335,1816,2482,3410,4705,6514,9048,12600,17588,24600,34466,48357,67931,95528,134454,189383,266921,376405,531037,749479,1058115,1494252,2110637,2981855,4213369,5954311,8415564,11895337,16815332,23771892,33608330,47517227,67185082,94996902,134325511,189940705,268587879,379806322,537086464,759506459,1074046656,1518862755,2147914739,3037513154,4295576945,6074725997,8590796761,12149027294,17181088469,24297453979,34361462691},
+                /*11*/ {1,1,2,3,4,6,8,11,13,15,17,20,22,25,29,34,39,46,55,66,80,98,122,153,194,248,322,421,557,741,995,1345,1828,2499,3433,4735,6555,9104,12677,17695,24748,34671,48643,68330,96085,135234,190478,268459,378569,534083,753769,1064161,1502778,2122665,2998831,4237337,5988158,8463373,11962880,16910771,23906766,33798957,47786676,67565979,95535377,135086800,191017056,270109743,381958176,540129185,763808968,1080130672,1527466079,2160080756,3054717406,4319906129,6109131111,8639451098,12217832729,17278391445,24435058071},
+                /*12*/ {1,1,2,3,4,6,8,11,13,14,16,18,20,23,26,30,34,40,47,55,66,80,98,122,153,194,248,322,421,556,740,992,1340,1822,2490,3419,4715,6526,9062,12617,17608,24623,34493,48389,67969,95573,134507,189446,266996,376495,531144,749606,1058266,1494431,2110850,2982107,4213669,5954668,8415989,11895842,16815932,23772605,33609179,47518236,67186282,94998329,134327208,189942723,268590278,379809175,537089858,759510494,1074051454,1518868461,2147921525,3037521223,4295586541,6074737408,8590810331,12149043432,17181107660},
+                /*13*/ {1,1,2,3,4,6,8,10,12,13,15,16,18,21,23,26,30,34,40,47,56,66,80,99,122,153,194,248,322,420,555,738,990,1336,1816,2481,3405,4695,6498,9021,12558,17524,24504,34322,48147,67625,95084,133813,188462,265601,374518,528343,745639,1052650,1486481,2099597,2966184,4191137,5922787,8370884,11832033,16725667,23644921,33428570,47262773,66824951,94487270,133604388,188920416,267144416,377764296,534197817,755420360,1068266927,1510687662,2136351839,3021158875,4272446278,6042011649,8544528543,12083590414},
+                /*14*/ {1,1,2,3,4,6,8,10,11,13,14,15,17,19,21,23,27,30,35,40,47,56,67,81,99,123,154,195,250,324,423,558,743,996,1344,1826,2495,3425,4722,6535,9072,12629,17622,24640,34513,48413,67998,95606,134547,189494,267052,376562,531223,749700,1058378,1494564,2111008,2982295,4213893,5954934,8416305,11896217,16816379,23773136,33609810,47518986,67187175,94999390,134328470,189944223,268592062,379811297,537092380,759513494,1074055022,1518872704,2147926570,3037527223,4295593676,6074745893,8590820421},
+                /*15*/ {1,1,2,3,4,6,8,9,11,12,13,14,15,17,19,21,24,27,31,35,41,48,56,67,82,100,124,155,196,251,325,424,559,744,997,1346,1829,2498,3428,4726,6539,9077,12635,17630,24650,34525,48429,68017,95631,134578,189534,267105,376630,531314,749820,1058538,1494780,2111300,2982693,4214438,5955682,8417337,11897647,16818364,23775900,33613668,47524380,67194730,95009988,134343354,189965150,268621510,379852769,537150825,759595901,1074171271,1519036758,2148158165,3037854257,4296055587,6075398440},
+                /*16*/ {1,1,2,3,4,6,8,9,10,11,12,13,14,16,17,19,21,24,27,31,35,41,48,57,68,82,100,124,155,196,251,325,425,560,745,999,1348,1830,2500,3431,4729,6542,9080,12639,17634,24654,34530,48433,68021,95634,134580,189533,267099,376617,531289,749778,1058470,1494674,2111138,2982450,4214077,5955153,8416565,11896527,16816747,23773574,33610331,47519606,67187911,95000266,134329511,189945462,268593535,379813048,537094463,759515970,1074057966,1518876206,2147930735,3037532176,4295599566},
+                /*17*/ {1,1,2,3,4,6,8,9,10,10,11,12,13,15,16,18,19,22,24,27,31,36,41,48,57,68,82,101,124,156,197,252,326,426,561,746,1000,1349,1832,2502,3433,4732,6546,9085,12645,17641,24663,34541,48447,68039,95657,134609,189570,267148,376682,531375,749893,1058625,1494883,2111422,2982839,4214610,5955888,8417581,11897937,16818709,23776311,33614156,47524960,67195420,95010808,134344329,189966310,268622890,379854410,537152776,759598221,1074174030,1519040039,2148162066,3037858896},
+                /*18*/ {1,1,2,3,4,6,8,8,9,10,11,11,12,14,15,16,18,20,22,24,27,31,36,41,48,57,68,83,101,125,156,198,253,327,426,562,747,1001,1350,1834,2504,3435,4734,6548,9088,12648,17645,24667,34544,48450,68042,95659,134609,189567,267140,376666,531347,749847,1058553,1494772,2111254,2982589,4214242,5955348,8416797,11896803,16817075,23773965,33610795,47520158,67188567,95001046,134330439,189946565,268594847,379814609,537096319,759518177,1074060591,1518879327,2147934446},
+                /*19*/ {1,1,2,3,4,6,7,8,9,9,10,11,12,13,14,15,16,18,20,22,24,28,31,36,42,49,57,69,83,101,125,157,198,253,327,427,563,748,1002,1352,1835,2506,3438,4737,6552,9092,12653,17651,24675,34555,48464,68059,95681,134637,189604,267188,376729,531431,749959,1058704,1494977,2111534,2982972,4214768,5956076,8417805,11898203,16819025,23776687,33614603,47525492,67196051,95011560,134345223,189967372,268624154,379855912,537154563,759600346,1074176557,1519043044},
+                /*20*/ {1,1,2,3,4,6,7,8,8,9,9,10,11,12,13,14,15,16,18,20,22,25,28,32,36,42,49,58,69,83,102,126,157,198,254,328,428,564,749,1003,1353,1837,2507,3439,4739,6554,9095,12656,17654,24678,34558,48467,68061,95682,134637,189600,267179,376712,531402,749912,1058629,1494863,2111363,2982718,4214395,5955531,8417015,11897062,16817383,23774330,33611230,47520674,67189181,95001777,134331307,189947598,268596075,379816069,537098055,759520242,1074063046},
+                /*21*/ {1,1,2,3,4,6,7,7,8,8,9,10,10,11,12,13,14,15,16,18,20,22,25,28,32,36,42,49,58,69,83,102,126,157,199,254,329,429,565,750,1004,1355,1838,2509,3442,4742,6558,9099,12661,17661,24687,34568,48480,68078,95703,134664,189636,267226,376774,531484,750023,1058779,1495066,2111641,2983098,4214919,5956255,8418018,11898456,16819326,23777044,33615028,47525997,67196652,95012274,134346072,189968382,268625355,379857341,537156261,759602366},
+                /*22*/ {1,1,2,3,4,6,7,7,8,8,9,9,10,10,11,12,13,14,15,17,18,20,22,25,28,32,36,42,49,58,69,84,102,126,158,199,255,329,429,565,751,1005,1356,1840,2511,3444,4744,6560,9102,12664,17664,24690,34571,48483,68080,95704,134663,189631,267216,376756,531454,749974,1058704,1494951,2111468,2982842,4214543,5955707,8417224,11897310,16817678,23774681,33611647,47521171,67189772,95002479,134332143,189948591,268597256,379817473,537099725},
+                /*23*/ {1,1,2,3,4,6,6,7,7,8,8,9,9,10,11,11,12,13,14,15,17,18,20,22,25,28,32,37,42,49,58,70,84,103,127,158,200,255,330,430,566,752,1007,1357,1841,2513,3446,4747,6564,9106,12669,17670,24698,34582,48495,68096,95725,134690,189667,267262,376818,531536,750084,1058852,1495153,2111744,2983221,4215065,5956428,8418224,11898701,16819618,23777391,33615440,47526487,67197235,95012968,134346897,189969363,268626521,379858728},
+                /*24*/ {1,1,2,3,4,6,6,7,7,7,8,8,9,9,10,11,11,12,13,14,15,17,18,20,23,25,28,32,37,43,50,59,70,84,103,127,159,200,256,330,431,567,753,1008,1358,1843,2514,3448,4749,6566,9108,12672,17673,24700,34584,48498,68098,95726,134689,189662,267252,376799,531505,750035,1058776,1495037,2111570,2982964,4214688,5955879,8417428,11897553,16817967,23775024,33612056,47521656,67190349,95003165,134332959,189949562,268598410},
+                /*25*/ {1,1,2,3,4,6,6,6,7,7,7,8,8,9,9,10,11,11,12,13,14,15,17,18,20,23,25,28,32,37,43,50,59,70,85,103,127,159,201,256,331,431,568,754,1009,1359,1844,2516,3449,4751,6568,9111,12675,17677,24704,34589,48503,68103,95730,134693,189665,267253,376796,531496,750016,1058742,1494982,2111482,2982828,4214482,5955572,8416976,11896891,16817004,23773631,33610047,47518771,67186215,94997255,134324525,189937545},
+                /*26*/ {1,1,2,3,4,5,6,6,6,7,7,8,8,8,9,9,10,11,11,12,13,14,16,17,19,21,23,25,29,32,37,43,50,59,70,85,103,128,159,201,257,331,432,568,755,1010,1361,1845,2517,3452,4753,6571,9115,12680,17682,24711,34597,48513,68116,95747,134714,189692,267288,376842,531556,750095,1058847,1495122,2111671,2983084,4214830,5956048,8417629,11897792,16818251,23775363,33612458,47522134,67190918,95003841,134333763},
+                /*27*/ {1,1,2,3,4,5,6,6,6,7,7,7,8,8,9,9,10,10,11,12,12,13,14,16,17,19,21,23,26,29,33,37,43,50,59,71,85,104,128,160,202,257,332,433,569,755,1011,1362,1847,2519,3454,4756,6574,9118,12684,17687,24717,34604,48522,68126,95760,134729,189711,267311,376870,531591,750140,1058904,1495194,2111764,2983204,4214987,5956254,8417901,11898154,16818736,23776017,33613345,47523345,67192576,95006123},
+                /*28*/ {1,1,2,3,4,5,5,6,6,6,7,7,7,8,8,9,9,10,10,11,12,12,13,14,16,17,19,21,23,26,29,33,37,43,50,59,71,85,104,128,160,202,258,333,433,570,756,1012,1363,1848,2521,3455,4758,6577,9121,12687,17691,24722,34610,48528,68134,95768,134739,189722,267323,376884,531606,750154,1058918,1495206,2111770,2983202,4214971,5956215,8417828,11898029,16818532,23775697,33612855,47522607,67191480},
+                /*29*/ {1,1,2,3,4,5,5,6,6,6,6,7,7,7,8,8,9,9,10,10,11,12,13,13,15,16,17,19,21,23,26,29,33,38,43,51,60,71,86,104,129,160,202,258,333,434,571,757,1013,1364,1850,2522,3457,4760,6579,9125,12691,17696,24728,34617,48537,68144,95781,134754,189740,267346,376912,531641,750199,1058974,1495278,2111863,2983322,4215127,5956420,8418099,11898390,16819016,23776350,33613741,47523815},
+                /*30*/ {1,1,2,3,4,5,5,5,6,6,6,6,7,7,7,8,8,9,9,10,10,11,12,13,14,15,16,17,19,21,23,26,29,33,38,44,51,60,71,86,105,129,161,203,259,334,435,571,758,1014,1365,1851,2524,3459,4762,6582,9128,12695,17700,24733,34622,48543,68152,95789,134764,189751,267358,376925,531655,750213,1058988,1495289,2111869,2983319,4215110,5956381,8418025,11898263,16818811,23776028,33613249},
+                /*31*/ {1,1,2,3,4,5,5,5,5,6,6,6,7,7,7,7,8,8,9,9,10,10,11,12,13,14,15,16,17,19,21,23,26,29,33,38,44,51,60,71,86,105,129,161,203,259,334,435,572,759,1015,1367,1852,2526,3461,4765,6585,9131,12698,17705,24738,34629,48550,68160,95799,134776,189766,267375,376945,531679,750241,1059021,1495328,2111916,2983374,4215175,5956457,8418114,11898367,16818932,23776168},
+                /*32*/ {1,1,2,3,4,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,12,13,14,15,16,17,19,21,23,26,29,33,38,44,51,60,72,86,105,130,162,204,260,335,436,573,760,1016,1368,1854,2527,3463,4767,6587,9134,12702,17709,24743,34635,48558,68169,95810,134789,189780,267393,376967,531704,750271,1059057,1495371,2111967,2983436,4215248,5956546,8418221,11898496,16819088},
+                /*33*/ {1,1,2,3,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,11,11,12,13,14,15,16,18,19,21,24,26,29,33,38,44,51,60,72,87,105,130,162,204,260,335,437,574,761,1017,1369,1855,2529,3465,4769,6590,9137,12706,17713,24748,34641,48565,68178,95820,134801,189795,267410,376987,531728,750299,1059090,1495410,2112013,2983490,4215313,5956621,8418309,11898599},
+                /*34*/ {1,1,2,3,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,11,11,12,13,14,15,16,18,19,21,24,26,30,34,38,44,52,61,72,87,106,130,162,205,261,336,437,574,762,1018,1370,1857,2531,3467,4771,6593,9140,12710,17718,24753,34647,48572,68186,95831,134813,189809,267428,377008,531753,750329,1059126,1495453,2112064,2983551,4215386,5956709,8418415},
+                /*35*/ {1,1,2,3,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,11,11,12,13,14,15,16,18,19,21,24,26,30,34,39,44,52,61,72,87,106,131,163,205,261,336,438,575,762,1019,1371,1858,2532,3469,4774,6595,9143,12713,17722,24759,34653,48580,68195,95841,134825,189824,267444,377028,531777,750357,1059159,1495492,2112110,2983606,4215450,5956784},
+                /*36*/ {1,1,2,3,4,4,4,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,9,9,10,10,11,11,12,13,14,15,16,18,20,22,24,27,30,34,39,45,52,61,73,87,106,131,163,205,262,337,438,576,763,1020,1372,1859,2534,3471,4776,6598,9146,12717,17727,24764,34660,48587,68204,95851,134837,189838,267462,377048,531801,750387,1059194,1495534,2112161,2983666,4215523},
+                /*37*/ {1,1,2,3,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,9,9,10,10,11,11,12,13,14,15,16,18,20,22,24,27,30,34,39,45,52,61,73,88,107,131,163,206,262,338,439,577,764,1021,1374,1861,2535,3473,4778,6601,9150,12721,17731,24769,34666,48594,68212,95861,134849,189853,267479,377068,531825,750415,1059227,1495573,2112207,2983720},
+                /*38*/ {1,1,2,3,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,9,9,10,10,11,12,12,13,14,15,17,18,20,22,24,27,30,34,39,45,52,61,73,88,107,132,164,206,263,338,440,577,765,1022,1375,1862,2537,3475,4780,6603,9153,12724,17735,24774,34672,48601,68221,95871,134862,189867,267496,377089,531849,750444,1059262,1495615,2112257},
+                /*39*/ {1,1,2,3,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,12,12,13,14,15,17,18,20,22,24,27,30,34,39,45,52,62,73,88,107,132,164,207,263,339,440,578,766,1023,1376,1863,2539,3476,4783,6606,9156,12728,17740,24779,34678,48609,68229,95882,134874,189881,267513,377109,531874,750473,1059296,1495656},
+                /*40*/ {1,1,2,3,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,12,12,13,14,15,17,18,20,22,24,27,30,34,39,45,53,62,74,88,107,132,164,207,264,339,441,579,767,1024,1377,1865,2540,3478,4785,6608,9159,12732,17744,24784,34684,48616,68238,95892,134886,189896,267530,377129,531897,750501,1059330},
+                /*41*/ {1,1,2,3,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,12,12,13,14,16,17,18,20,22,24,27,31,35,39,45,53,62,74,89,108,132,165,207,264,340,442,580,768,1025,1378,1866,2542,3480,4787,6611,9162,12735,17748,24789,34690,48623,68246,95902,134898,189910,267547,377149,531921,750529},
+                /*42*/ {1,1,2,3,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,12,13,13,14,16,17,18,20,22,24,27,31,35,40,46,53,62,74,89,108,133,165,208,265,340,442,580,768,1026,1379,1868,2543,3482,4789,6614,9165,12739,17753,24795,34696,48630,68255,95912,134910,189924,267564,377169,531945},
+                /*43*/ {1,1,2,3,3,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,12,13,14,15,16,17,18,20,22,25,27,31,35,40,46,53,62,74,89,108,133,166,208,265,341,443,581,769,1027,1381,1869,2545,3484,4791,6616,9168,12743,17757,24800,34702,48637,68263,95922,134921,189938,267580,377189},
+                /*44*/ {1,1,2,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,9,9,9,10,11,11,12,13,14,15,16,17,19,20,22,25,28,31,35,40,46,53,63,74,89,109,133,166,209,265,341,444,582,770,1028,1382,1870,2547,3486,4794,6619,9171,12746,17761,24805,34708,48644,68272,95932,134933,189952,267597},
+                /*45*/ {1,1,2,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,9,9,9,10,11,11,12,13,14,15,16,17,19,20,22,25,28,31,35,40,46,54,63,75,90,109,134,166,209,266,342,444,583,771,1029,1383,1872,2548,3488,4796,6621,9174,12750,17765,24810,34714,48651,68280,95942,134945,189966},
+                /*46*/ {1,1,2,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,9,9,10,10,11,11,12,13,14,15,16,17,19,20,23,25,28,31,35,40,46,54,63,75,90,109,134,167,210,266,342,445,583,772,1030,1384,1873,2550,3490,4798,6624,9177,12753,17770,24815,34720,48658,68288,95952,134957},
+                /*47*/ {1,1,2,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,11,12,13,14,15,16,17,19,21,23,25,28,31,35,40,46,54,63,75,90,109,134,167,210,267,343,445,584,773,1031,1385,1874,2551,3491,4800,6627,9180,12757,17774,24820,34726,48666,68297,95962},
+                /*48*/ {1,1,2,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,11,12,13,14,15,16,17,19,21,23,25,28,31,35,40,47,54,63,75,90,110,135,167,210,267,344,446,585,773,1032,1386,1876,2553,3493,4802,6629,9183,12760,17778,24825,34732,48673,68305},
+                /*49*/ {1,1,2,3,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,11,12,13,14,15,16,17,19,21,23,25,28,32,36,41,47,54,64,76,91,110,135,168,211,268,344,447,585,774,1033,1387,1877,2554,3495,4804,6632,9186,12764,17782,24830,34738,48680},
+                /*50*/ {1,1,2,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,12,12,13,14,15,16,18,19,21,23,25,28,32,36,41,47,54,64,76,91,110,135,168,211,268,345,447,586,775,1034,1389,1878,2556,3497,4807,6634,9189,12768,17786,24835,34743},
+                /*51*/ {1,1,2,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,12,12,13,14,15,16,18,19,21,23,25,28,32,36,41,47,55,64,76,91,111,136,168,212,269,345,448,587,776,1035,1390,1880,2558,3499,4809,6637,9192,12771,17791,24840},
+                /*52*/ {1,1,2,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,12,12,13,14,15,16,18,19,21,23,26,28,32,36,41,47,55,64,76,91,111,136,169,212,269,346,448,588,777,1035,1391,1881,2559,3500,4811,6639,9195,12775,17795},
+                /*53*/ {1,1,2,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,9,9,9,10,10,11,12,12,13,14,15,16,18,19,21,23,26,29,32,36,41,47,55,64,76,92,111,136,169,212,270,346,449,588,778,1036,1392,1882,2561,3502,4813,6642,9198,12778},
+                /*54*/ {1,1,2,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,9,9,9,10,10,11,12,12,13,14,15,16,18,19,21,23,26,29,32,36,41,48,55,65,77,92,111,137,169,213,270,347,450,589,778,1037,1393,1884,2562,3504,4815,6644,9201},
+                /*55*/ {1,1,2,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,8,9,9,9,10,11,11,12,13,13,14,15,17,18,19,21,23,26,29,32,36,41,48,55,65,77,92,112,137,170,213,271,347,450,590,779,1038,1394,1885,2564,3506,4817,6647},
+                /*56*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,11,12,13,13,14,15,17,18,20,21,23,26,29,32,37,42,48,56,65,77,92,112,137,170,214,271,348,451,590,780,1039,1395,1886,2565,3508,4819},
+                /*57*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,11,12,13,14,14,16,17,18,20,21,24,26,29,32,37,42,48,56,65,77,93,112,138,171,214,272,348,452,591,781,1040,1396,1887,2567,3510},
+                /*58*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,13,14,15,16,17,18,20,22,24,26,29,33,37,42,48,56,65,78,93,112,138,171,214,272,349,452,592,782,1041,1398,1889,2568},
+                /*59*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,13,14,15,16,17,18,20,22,24,26,29,33,37,42,48,56,66,78,93,113,138,171,215,272,349,453,592,782,1042,1399,1890},
+                /*60*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,13,14,15,16,17,18,20,22,24,26,29,33,37,42,48,56,66,78,93,113,138,172,215,273,350,453,593,783,1043,1400},
+                /*61*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,13,14,15,16,17,18,20,22,24,26,29,33,37,42,49,56,66,78,94,113,139,172,216,273,350,454,594,784,1044},
+                /*62*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,9,9,9,10,10,11,12,12,13,14,15,16,17,18,20,22,24,27,30,33,37,43,49,57,66,78,94,114,139,172,216,274,351,455,595,785},
+                /*63*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,8,9,9,9,10,10,11,12,12,13,14,15,16,17,19,20,22,24,27,30,33,37,43,49,57,66,79,94,114,139,173,216,274,351,455,595},
+                /*64*/ {1,1,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,8,9,9,9,10,10,11,12,12,13,14,15,16,17,19,20,22,24,27,30,33,38,43,49,57,67,79,94,114,140,173,217,275,352,456},
+                /*65*/ {1,1,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,12,12,13,14,15,16,17,19,20,22,24,27,30,33,38,43,49,57,67,79,95,114,140,173,217,275,352},
+                /*66*/ {1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,12,13,14,15,16,17,19,20,22,24,27,30,34,38,43,49,57,67,79,95,115,140,174,218,276},
+                /*67*/ {1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,12,13,14,15,16,17,19,21,22,25,27,30,34,38,43,50,57,67,79,95,115,141,174,218},
+                /*68*/ {1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,13,13,14,15,16,18,19,21,22,25,27,30,34,38,43,50,58,67,80,95,115,141,174},
+                /*69*/ {1,1,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,13,13,14,15,16,18,19,21,23,25,27,30,34,38,44,50,58,68,80,95,115,141},
+                /*70*/ {1,1,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,13,13,14,15,16,18,19,21,23,25,27,30,34,38,44,50,58,68,80,96,116},
+                /*71*/ {1,1,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,8,8,8,9,9,9,10,10,11,11,12,13,14,14,15,16,18,19,21,23,25,28,31,34,39,44,50,58,68,80,96},
+                /*72*/ {1,1,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,13,14,14,15,17,18,19,21,23,25,28,31,34,39,44,50,58,68,81},
+                /*73*/ {1,1,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,13,14,15,16,17,18,19,21,23,25,28,31,34,39,44,51,58,68},
+                /*74*/ {1,1,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,12,12,13,14,15,16,17,18,19,21,23,25,28,31,35,39,44,51,59},
+                /*75*/ {1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,12,12,13,14,15,16,17,18,20,21,23,25,28,31,35,39,44,51},
+                /*76*/ {1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,10,11,12,12,13,14,15,16,17,18,20,21,23,25,28,31,35,39,45},
+                /*77*/ {1,1,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,12,13,14,15,16,17,18,20,21,23,26,28,31,35,39},
+                /*78*/ {1,1,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,12,13,14,15,16,17,18,20,21,23,26,28,31,35},
+                /*79*/ {1,1,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,10,10,11,11,12,12,13,14,15,16,17,18,20,22,23,26,28,31},
+                /*80*/ {1,1,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,14,15,16,17,18,20,22,24,26,28},
+            },
+            { // ssp 80
+                /*0*/ {1,1,2,3,4,6,8,11,16,23,32,45,64,91,128,181,256,362,512,724,1024,1448,2048,2896,4096,5793,8192,11585,16384,23170,32768,46341,65536,92682,131072,185364,262144,370728,524288,741455,1048576,1482910,2097152,2965821,4194304,5931642,8388608,11863283,16777216,23726566,33554432,47453133,67108864,94906266,134217728,189812531,268435456,379625062,536870912,759250125,1073741824,1518500250,2147483648,3037000500,4294967296,6074001000,8589934592,12148002000,17179869184,24296004000,34359738368,48592008000,68719476736,97184015999,137438953472,194368031998,274877906944,388736063997,549755813888,777472127994,1099511627776},
+                /*1*/ {1,1,2,3,4,6,8,11,16,23,32,45,64,91,128,181,256,362,512,724,1024,1448,2048,2896,4096,5793,8192,11585,16384,23170,32768,46341,65536,92682,131072,185364,262144,370728,524288,741455,1048576,1482910,2097152,2965821,4194304,5931642,8388608,11863283,16777216,23726566,33554432,47453133,67108864,94906266,134217728,189812531,268435456,379625062,536870912,759250125,1073741824,1518500250,2147483648,3037000500,4294967296,6074001000,8589934592,12148002000,17179869184,24296004000,34359738368,48592008000,68719476736,97184015999,137438953472,194368031998,274877906944,388736063997,549755813888,777472127994,1099511627776},
+                /*2*/ {1,1,2,3,4,6,8,11,16,23,32,45,64,89,118,156,207,276,370,499,675,918,1256,1724,2376,3287,4561,6346,8850,12368,17315,24277,34084,47906,67398,94896,133705,188495,265868,375156,529554,747717,1056023,1491767,2107684,2978346,4209199,5949355,8409673,11888333,16807006,23761993,33596561,47503233,67168444,94977118,134301986,189912732,268554615,379766768,537039429,759450526,1073980143,1518783660,2147820682,3037401303,4295443934,6074567821,8590608659,12148803606,17180822459,24297137642,34361086503,48593611211,68721383286,97186283282,137441649741,194371238421,274881720045,388740598563,549761206427},
+                /*3*/ {1,1,2,3,4,6,8,11,16,23,32,45,60,78,100,128,166,217,285,376,502,673,908,1232,1682,2307,3177,4391,6090,8470,11809,16500,23097,32381,45458,63889,89879,126545,178293,251348,354515,500236,706105,996995,1408075,1989073,2810305,3971197,5612346,7932568,11213009,15851244,22409498,31682842,44795634,63337903,89558232,126636521,179069747,253217488,358073428,506356412,716053429,1012601720,1431974734,2025046318,2863762618,4049870435,5727260992,8099426631,11454148291,16198408864,22907768102,32396189256,45814788822,64791489721,91628520688,129581722506,183255546619,259161667436,366508979333},
+                /*4*/ {1,1,2,3,4,6,8,11,16,23,32,43,55,70,88,111,142,182,236,309,407,540,723,973,1319,1798,2462,3387,4678,6483,9012,12559,17540,24544,34400,48280,67840,95420,134326,189232,266743,376195,530788,749184,1057765,1493837,2110144,2981269,4212673,5953485,8414583,11894171,16813946,23770244,33606372,47514899,67182315,94993612,134321600,189936054,268582349,379799747,537078646,759497162,1074035601,1518849610,2147899108,3037494566,4295554841,6074699711,8590765503,12148990123,17181044266,24297401414,34361400181,48593984238,68721826891,97186810818,137442277089,194371984466,274882607244},
+                /*5*/ {1,1,2,3,4,6,8,11,16,23,31,39,48,60,73,91,114,143,183,235,305,399,527,702,942,1271,1727,2359,3238,4463,6174,8569,11926,16638,23259,32573,45685,64158,90197,126922,178740,251879,355145,500984,706993,998050,1409329,1990563,2812076,3973302,5614849,7935543,11216545,15855448,22414496,31688785,44802700,63346305,89568223,126648401,179083873,253234286,358093404,506380166,716081676,1012635311,1432014678,2025093820,2863819106,4049937609,5727340876,8099521628,11454261260,16198543207,22907927862,32396379243,45815014754,64791758401,91628840203,129582102474,183255998478},
+                /*6*/ {1,1,2,3,4,6,8,11,16,23,30,36,44,53,65,79,98,122,153,195,250,324,424,560,745,999,1349,1832,2502,3434,4733,6547,9087,12647,17645,24667,34545,48452,68044,95662,134614,189573,267147,376675,531358,749860,1058569,1494791,2111278,2982617,4214276,5955390,8416847,11896862,16817146,23774049,33610896,47520278,67188711,95001217,134330643,189946808,268595136,379814952,537096728,759518664,1074061170,1518880016,2147935266,3037537565,4295605975,6074760520,8590837816,12149076117,17181146529,24297523025,34361544802,48594156221,68722031413,97187054037,137442566326},
+                /*7*/ {1,1,2,3,4,6,8,11,16,23,28,33,39,47,56,68,83,102,127,159,202,259,336,439,578,769,1031,1391,1888,2578,3537,4874,6741,9355,13018,18159,25384,35546,49852,70006,98416,138482,195015,274808,387467,546570,771315,1088841,1537519,2171606,3067817,4334627,6125427,8657119,12236425,17297082,24452451,34569908,48876058,69105519,97711333,138162540,195364995,276256500,390648437,552416020,781181548,1104694894,1562200005,2209195843,3124169370,4418117410,6248012574,8835846943,12495563884,17671145351,24990475448,35341514962,49980028384,70681932869,99958752144},
+                /*8*/ {1,1,2,3,4,6,8,11,16,22,25,30,35,41,48,58,69,84,103,127,159,201,257,332,433,570,757,1012,1364,1850,2523,3458,4761,6581,9126,12694,17699,24731,34621,48542,68150,95788,134763,189750,267357,376924,531654,750212,1058986,1495288,2111868,2983318,4215109,5956380,8418024,11898262,16818810,23776027,33613248,47523075,67192036,95005172,134335345,189952399,268601785,379822859,537106130,759529845,1074074466,1518895827,2147954068,3037559924,4295632564,6074792139,8590875417,12149120833,17181199705,24297586262,34361620002,48594245649,68722137762},
+                /*9*/ {1,1,2,3,4,6,8,11,16,20,23,27,31,36,42,50,59,70,85,104,128,159,201,257,331,431,566,751,1003,1350,1829,2493,3415,4699,6492,8999,12512,17441,24365,34101,47803,67103,94303,132659,186771,263138,370951,523199,738247,1042055,1471330,2077972,2935365,4147272,5860420,8282287,11706267,16547247,23391930,33069995,46754730,66105352,93468271,132161724,186878298,264254187,373674233,528410431,747231996,1056682357,1494299284,2113168845,2988365644,4226060697,5976401888,8451729673,11952337943,16902905376,23904017105,33805027329,47807102560},
+                /*10*/ {1,1,2,3,4,6,8,11,16,19,22,25,28,32,37,43,51,60,72,87,106,130,163,205,261,337,438,576,763,1020,1373,1860,2535,3472,4777,6600,9149,12720,17730,24768,34665,48593,68211,95860,134848,189851,267477,377067,531823,750413,1059225,1495572,2112205,2983719,4215586,5956947,8418698,11899063,16819762,23777159,33614594,47524675,67193939,95007434,134338035,189955598,268605589,379827382,537111509,759536241,1074082072,1518904873,2147964825,3037572716,4295647776,6074810228,8590896929,12149146414,17181230126,24297622439,34361663024},
+                /*11*/ {1,1,2,3,4,6,8,11,15,18,20,23,26,29,33,38,44,52,61,73,88,107,132,164,207,264,340,442,581,769,1028,1383,1873,2552,3495,4808,6641,9206,12798,17837,24916,34870,48880,68611,96419,135631,190949,269018,379233,534872,754707,1065276,1504103,2124241,3000704,4239563,5990804,8466520,11966622,16915220,23912056,33805247,47794155,67574872,95545953,135099376,191032011,270127527,381979324,540154334,763838875,1080166236,1527508372,2160131051,3054777215,4319977255,6109215693,8639551683,12217952345,17278533692,24435227232},
+                /*12*/ {1,1,2,3,4,6,8,11,14,17,19,21,23,26,30,34,39,45,52,62,73,88,107,132,165,207,264,340,442,580,768,1025,1378,1866,2542,3481,4788,6612,9163,12737,17750,24791,34692,48626,68250,95906,134903,189916,267554,377158,531931,750541,1059378,1495752,2112420,2983975,4215889,5957307,8419127,11899573,16820368,23777880,33615451,47525694,67195151,95008875,134339748,189957635,268608011,379830263,537114935,759540315,1074086917,1518910633,2147971676,3037580862,4295657464,6074821749,8590910629,12149162707,17181249501},
+                /*13*/ {1,1,2,3,4,6,8,11,14,16,17,19,21,24,27,30,34,39,45,53,62,74,89,108,132,165,207,264,339,441,579,766,1022,1374,1860,2533,3467,4768,6583,9122,12678,17666,24671,34521,48383,67904,95416,134207,188930,266156,375178,529127,746571,1053757,1487797,2101162,2968044,4193349,5925417,8374010,11835750,16730087,23650176,33434818,47270203,66833787,94497776,133616882,188935273,267162083,377785306,534222801,755450070,1068302258,1510729678,2136401804,3021218292,4272516937,6042095677,8544628469,12083709246},
+                /*14*/ {1,1,2,3,4,6,8,11,13,15,16,18,20,22,24,27,31,35,40,46,53,63,74,89,109,133,166,209,266,342,444,582,771,1028,1382,1871,2548,3487,4795,6620,9173,12749,17764,24808,34712,48649,68277,95939,134941,189962,267609,377223,532008,750633,1059487,1495882,2112574,2984158,4216107,5957566,8419434,11899938,16820803,23778397,33616066,47526425,67196020,95009908,134340977,189959096,268609749,379832329,537117391,759543236,1074090390,1518914764,2147976588,3037586704,4295664410,6074830010,8590920453},
+                /*15*/ {1,1,2,3,4,6,8,11,12,14,15,16,18,20,22,25,27,31,35,40,46,54,63,75,90,109,134,167,209,266,342,445,583,772,1030,1384,1873,2550,3490,4799,6625,9178,12755,17772,24818,34724,48664,68296,95962,134972,190001,267660,377290,532097,750751,1059645,1496095,2112863,2984552,4216647,5958309,8420460,11901360,16822779,23781150,33619910,47531803,67203556,95020484,134355835,189979992,268639160,379873758,537175784,759625582,1074206567,1519078732,2148208079,3037913615,4296126176,6075482383},
+                /*16*/ {1,1,2,3,4,6,8,10,12,13,14,15,17,18,20,22,25,28,31,35,40,46,54,63,75,90,109,134,167,210,267,343,446,584,773,1031,1385,1875,2552,3492,4801,6627,9181,12758,17775,24821,34728,48668,68300,95965,134973,189999,267652,377275,532070,750706,1059574,1495986,2112698,2984304,4216281,5957773,8419681,11900231,16821151,23778811,33616558,47527010,67196716,95010736,134341961,189960267,268611141,379833984,537119360,759545577,1074093174,1518918075,2147980525,3037591386,4295669978},
+                /*17*/ {1,1,2,3,4,6,8,10,11,12,13,14,16,17,19,20,23,25,28,31,35,40,47,54,63,75,90,110,135,167,210,268,344,446,585,774,1032,1387,1876,2554,3494,4804,6631,9186,12764,17782,24830,34738,48681,68317,95987,135001,190035,267700,377338,532154,750819,1059726,1496191,2112978,2984688,4216808,5958501,8420689,11901632,16823102,23781534,33620367,47532346,67204201,95021251,134356747,189981076,268640450,379875292,537177608,759627751,1074209146,1519081799,2148211727,3037917952},
+                /*18*/ {1,1,2,3,4,6,8,10,11,12,13,14,15,16,17,19,21,23,25,28,31,36,41,47,54,64,76,91,110,135,168,211,268,344,447,586,775,1033,1388,1878,2555,3496,4806,6633,9188,12766,17785,24833,34741,48684,68319,95988,135000,190031,267691,377320,532124,750771,1059650,1496076,2112805,2984432,4216433,5957954,8419896,11900487,16821456,23779173,33616988,47527522,67197324,95011459,134342822,189961290,268612357,379835431,537121080,759547623,1074095607,1518920968,2147983965},
+                /*19*/ {1,1,2,3,4,6,8,9,10,11,12,13,14,15,16,17,19,21,23,25,28,32,36,41,47,55,64,76,91,110,136,168,211,269,345,448,587,776,1034,1390,1879,2557,3499,4809,6637,9192,12771,17791,24841,34751,48697,68335,96009,135027,190066,267737,377381,532206,750880,1059799,1496278,2113081,2984810,4216954,5958674,8420895,11901877,16823393,23781880,33620778,47532835,67204783,95021943,134357570,189982055,268641614,379876675,537179253,759629708,1074211473,1519084566},
+                /*20*/ {1,1,2,3,4,6,8,9,10,11,11,12,13,14,15,16,18,19,21,23,25,28,32,36,41,47,55,64,76,91,111,136,169,212,269,346,448,587,777,1035,1391,1881,2559,3500,4811,6639,9195,12774,17794,24844,34754,48699,68337,96009,135025,190061,267726,377362,532174,750830,1059721,1496160,2112905,2984551,4216574,5958122,8420095,11900724,16821737,23779508,33617386,47527995,67197887,95012129,134343617,189962236,268613482,379836769,537122671,759549515,1074097857},
+                /*21*/ {1,1,2,3,4,6,8,9,9,10,11,11,12,13,14,15,16,18,19,21,23,26,28,32,36,41,47,55,64,76,92,111,136,169,212,270,346,449,588,778,1036,1392,1882,2561,3502,4813,6642,9199,12779,17800,24851,34764,48712,68353,96029,135051,190095,267772,377423,532255,750938,1059868,1496360,2113178,2984926,4217092,5958838,8421089,11902108,16823668,23782207,33621166,47533296,67205332,95022596,134358346,189982978,268642711,379877980,537180805,759631553},
+                /*22*/ {1,1,2,3,4,6,8,8,9,10,10,11,12,12,13,14,15,16,18,19,21,23,26,29,32,36,41,47,55,65,77,92,111,137,169,213,270,347,450,589,778,1037,1393,1883,2562,3504,4815,6644,9201,12781,17803,24854,34766,48714,68354,96029,135049,190089,267760,377403,532222,750887,1059788,1496241,2113001,2984664,4216709,5958282,8420285,11900951,16822007,23779828,33617767,47528448,67198425,95012769,134344379,189963141,268614559,379838049,537124194},
+                /*23*/ {1,1,2,3,4,6,7,8,9,9,10,10,11,12,12,13,14,15,17,18,19,21,23,26,29,32,36,41,48,55,65,77,92,112,137,170,213,271,347,450,590,779,1038,1394,1885,2564,3506,4818,6647,9205,12786,17809,24861,34776,48726,68369,96049,135075,190123,267805,377462,532302,750994,1059934,1496439,2113272,2985038,4217224,5958996,8421277,11902331,16823933,23782522,33621542,47533743,67205863,95023227,134359096,189983870,268643772,379879242},
+                /*24*/ {1,1,2,3,4,6,7,8,8,9,9,10,10,11,12,13,13,14,15,17,18,20,21,23,26,29,32,37,42,48,55,65,77,92,112,137,170,214,271,348,451,590,780,1039,1395,1886,2565,3508,4819,6649,9207,12788,17811,24864,34778,48728,68370,96049,135072,190117,267793,377442,532269,750942,1059854,1496319,2113094,2984775,4216840,5958438,8420471,11901171,16822269,23780140,33618138,47528889,67198950,95013393,134345121,189964024,268615608},
+                /*25*/ {1,1,2,3,4,6,7,7,8,8,9,9,10,11,11,12,13,13,14,15,17,18,20,21,24,26,29,32,37,42,48,56,65,77,93,112,137,171,214,271,348,451,591,781,1040,1396,1887,2567,3509,4821,6651,9209,12791,17814,24867,34782,48731,68374,96052,135075,190119,267792,377436,532257,750920,1059817,1496259,2113001,2984634,4216629,5958124,8420010,11900498,16821293,23778731,33616111,47525981,67194790,95007451,134336650,189951962},
+                /*26*/ {1,1,2,3,4,6,7,7,8,8,9,9,10,10,11,11,12,13,14,14,16,17,18,20,22,24,26,29,33,37,42,48,56,65,78,93,112,138,171,214,272,349,452,592,782,1041,1397,1889,2568,3511,4824,6654,9213,12795,17819,24874,34790,48741,68387,96068,135095,190145,267826,377480,532315,750997,1059919,1496396,2113185,2984884,4216970,5958592,8420654,11901389,16822527,23780447,33618504,47529323,67199466,95014007,134345851},
+                /*27*/ {1,1,2,3,4,6,7,7,7,8,8,9,9,10,10,11,11,12,13,14,15,16,17,18,20,22,24,26,29,33,37,42,48,56,66,78,93,113,138,171,215,272,349,453,592,782,1042,1399,1890,2570,3513,4826,6657,9216,12799,17824,24879,34796,48749,68396,96080,135110,190162,267847,377507,532348,751039,1059973,1496464,2113274,2984998,4217120,5958790,8420917,11901740,16823000,23781086,33619373,47530512,67201099,95016258},
+                /*28*/ {1,1,2,3,4,6,6,7,7,8,8,8,9,9,10,10,11,11,12,13,14,15,16,17,18,20,22,24,26,29,33,37,42,48,56,66,78,93,113,138,172,215,273,350,453,593,783,1043,1400,1891,2571,3515,4828,6659,9219,12802,17828,24883,34801,48755,68403,96088,135118,190172,267858,377519,532360,751051,1059983,1496472,2113276,2984991,4217098,5958744,8420835,11901603,16822783,23780751,33618865,47529753,67199977},
+                /*29*/ {1,1,2,3,4,6,6,7,7,7,8,8,8,9,9,10,10,11,11,12,13,14,15,16,17,18,20,22,24,26,29,33,37,42,49,56,66,78,94,113,139,172,216,273,350,454,594,784,1044,1401,1893,2573,3517,4830,6662,9222,12806,17832,24889,34808,48763,68412,96099,135132,190189,267879,377545,532393,751093,1060036,1496540,2113364,2985106,4217247,5958942,8421097,11901954,16823254,23781389,33619733,47530940},
+                /*30*/ {1,1,2,3,4,6,6,6,7,7,7,8,8,8,9,9,10,10,11,12,12,13,14,15,16,17,18,20,22,24,27,30,33,37,43,49,57,66,78,94,114,139,172,216,274,351,455,595,785,1045,1402,1894,2574,3518,4832,6664,9224,12809,17836,24893,34813,48769,68419,96107,135141,190199,267890,377556,532405,751104,1060047,1496547,2113365,2985098,4217225,5958895,8421014,11901817,16823036,23781052,33619223},
+                /*31*/ {1,1,2,3,4,6,6,6,7,7,7,7,8,8,9,9,9,10,10,11,12,12,13,14,15,16,17,19,20,22,24,27,30,33,37,43,49,57,66,79,94,114,139,173,216,274,351,455,595,786,1046,1403,1895,2576,3520,4834,6666,9227,12813,17840,24898,34818,48775,68427,96116,135152,190212,267905,377575,532427,751130,1060077,1496583,2113408,2985148,4217283,5958964,8421094,11901910,16823144,23781177},
+                /*32*/ {1,1,2,3,4,5,6,6,6,7,7,7,8,8,8,9,9,9,10,10,11,12,12,13,14,15,16,17,19,20,22,24,27,30,33,38,43,49,57,67,79,94,114,140,173,217,275,352,456,596,787,1047,1404,1896,2577,3522,4836,6669,9230,12816,17844,24903,34824,48782,68435,96126,135163,190225,267921,377594,532450,751157,1060110,1496622,2113454,2985204,4217351,5959045,8421192,11902028,16823288},
+                /*33*/ {1,1,2,3,4,5,6,6,6,6,7,7,7,8,8,8,9,9,9,10,10,11,12,12,13,14,15,16,17,19,20,22,24,27,30,33,38,43,49,57,67,79,95,114,140,173,217,275,352,456,597,787,1048,1405,1898,2579,3524,4838,6671,9233,12819,17848,24907,34830,48789,68443,96135,135174,190238,267937,377612,532471,751183,1060140,1496658,2113497,2985253,4217409,5959113,8421272,11902121},
+                /*34*/ {1,1,2,3,4,5,5,6,6,6,6,7,7,7,8,8,8,9,9,10,10,11,11,12,12,13,14,15,16,17,19,20,22,24,27,30,34,38,43,49,57,67,79,95,115,140,174,218,276,353,457,597,788,1049,1406,1899,2580,3525,4840,6674,9236,12823,17852,24912,34835,48795,68451,96144,135186,190252,267953,377631,532494,751210,1060172,1496697,2113543,2985309,4217476,5959194,8421369},
+                /*35*/ {1,1,2,3,4,5,5,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,12,13,14,15,16,17,19,21,22,25,27,30,34,38,43,50,57,67,79,95,115,141,174,218,276,353,457,598,789,1050,1407,1900,2582,3527,4842,6676,9239,12826,17856,24917,34841,48802,68459,96154,135197,190265,267968,377650,532516,751235,1060203,1496732,2113585,2985358,4217534,5959261},
+                /*36*/ {1,1,2,3,4,5,5,5,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,13,13,14,15,16,18,19,21,22,25,27,30,34,38,43,50,58,67,80,95,115,141,174,218,276,354,458,599,790,1051,1408,1901,2583,3529,4844,6679,9242,12830,17860,24922,34846,48809,68467,96163,135208,190278,267984,377669,532538,751262,1060235,1496771,2113631,2985414,4217600},
+                /*37*/ {1,1,2,3,4,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,13,13,14,15,16,18,19,21,23,25,27,30,34,38,44,50,58,68,80,95,115,141,175,219,277,355,459,599,790,1051,1410,1903,2585,3531,4846,6681,9245,12833,17864,24926,34852,48815,68474,96172,135219,190291,267999,377687,532560,751288,1060265,1496806,2113673,2985463},
+                /*38*/ {1,1,2,3,4,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,13,13,14,15,16,18,19,21,23,25,27,30,34,38,44,50,58,68,80,96,116,141,175,219,277,355,459,600,791,1052,1411,1904,2586,3532,4848,6683,9247,12836,17868,24931,34858,48822,68482,96182,135230,190304,268015,377706,532582,751315,1060297,1496845,2113719},
+                /*39*/ {1,1,2,3,4,5,5,5,5,5,6,6,6,6,6,7,7,7,8,8,8,8,9,9,10,10,11,11,12,13,14,14,15,16,18,19,21,23,25,28,31,34,39,44,50,58,68,80,96,116,142,175,219,278,356,460,601,792,1053,1412,1905,2588,3534,4851,6686,9250,12840,17872,24936,34863,48829,68490,96191,135241,190317,268031,377724,532604,751341,1060328,1496882},
+                /*40*/ {1,1,2,3,4,5,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,13,14,14,15,17,18,19,21,23,25,28,31,34,39,44,50,58,68,81,96,116,142,176,220,278,356,460,601,793,1054,1413,1907,2589,3536,4853,6688,9253,12843,17876,24940,34869,48835,68498,96200,135252,190330,268046,377742,532626,751367,1060359},
+                /*41*/ {1,1,2,3,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,13,14,15,16,17,18,19,21,23,25,28,31,34,39,44,51,58,68,81,96,116,142,176,220,279,357,461,602,794,1055,1414,1908,2591,3538,4855,6691,9256,12846,17880,24945,34874,48842,68506,96209,135263,190343,268062,377761,532648,751393},
+                /*42*/ {1,1,2,3,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,12,12,13,14,15,16,17,18,19,21,23,25,28,31,35,39,44,51,59,69,81,97,117,143,176,221,279,357,462,603,794,1056,1415,1909,2592,3539,4857,6693,9259,12850,17884,24950,34880,48848,68513,96219,135274,190356,268077,377779,532669},
+                /*43*/ {1,1,2,3,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,12,12,13,14,15,16,17,18,20,21,23,25,28,31,35,39,44,51,59,69,81,97,117,143,177,221,280,358,462,603,795,1057,1416,1910,2594,3541,4859,6695,9262,12853,17888,24954,34885,48855,68521,96228,135285,190369,268092,377797},
+                /*44*/ {1,1,2,3,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,10,11,12,12,13,14,15,16,17,18,20,21,23,25,28,31,35,39,45,51,59,69,81,97,117,143,177,221,280,358,463,604,796,1058,1417,1911,2595,3543,4861,6698,9264,12856,17891,24959,34891,48861,68529,96237,135295,190382,268108},
+                /*45*/ {1,1,2,3,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,12,13,14,15,16,17,18,20,21,23,26,28,31,35,39,45,51,59,69,82,97,118,144,177,222,280,359,463,605,797,1059,1418,1913,2596,3544,4863,6700,9267,12860,17895,24964,34896,48868,68537,96246,135306,190395},
+                /*46*/ {1,1,2,3,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,9,9,10,10,11,11,12,12,13,14,15,16,17,18,20,21,23,26,28,31,35,39,45,51,59,69,82,98,118,144,178,222,281,359,464,605,798,1060,1419,1914,2598,3546,4865,6703,9270,12863,17899,24968,34902,48874,68544,96255,135317},
+                /*47*/ {1,1,2,3,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,10,10,11,11,12,12,13,14,15,16,17,18,20,22,23,26,28,31,35,40,45,51,60,69,82,98,118,144,178,223,281,360,465,606,798,1061,1420,1915,2599,3548,4867,6705,9273,12866,17903,24973,34907,48881,68552,96264},
+                /*48*/ {1,1,2,3,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,14,15,16,17,18,20,22,24,26,28,32,35,40,45,52,60,70,82,98,118,144,178,223,282,360,465,607,799,1061,1421,1916,2601,3550,4869,6707,9275,12869,17907,24977,34913,48887,68560},
+                /*49*/ {1,1,2,3,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,13,13,14,15,16,17,19,20,22,24,26,29,32,35,40,45,52,60,70,82,98,119,145,179,223,282,361,466,607,800,1062,1422,1918,2602,3551,4871,6710,9278,12873,17911,24982,34918,48893},
+                /*50*/ {1,1,2,3,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,13,13,14,15,16,17,19,20,22,24,26,29,32,36,40,45,52,60,70,83,99,119,145,179,224,283,361,466,608,801,1063,1423,1919,2604,3553,4873,6712,9281,12876,17915,24987,34923},
+                /*51*/ {1,1,2,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,13,13,14,15,16,17,19,20,22,24,26,29,32,36,40,46,52,60,70,83,99,119,145,179,224,283,362,467,609,801,1064,1424,1920,2605,3555,4875,6714,9284,12879,17919,24991},
+                /*52*/ {1,1,2,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,13,13,14,15,16,17,19,20,22,24,26,29,32,36,40,46,52,60,70,83,99,119,146,180,224,283,362,467,609,802,1065,1425,1921,2606,3556,4877,6717,9286,12883,17922},
+                /*53*/ {1,1,2,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,13,14,14,15,16,17,19,20,22,24,26,29,32,36,40,46,52,61,71,83,99,120,146,180,225,284,363,468,610,803,1066,1426,1923,2608,3558,4879,6719,9289,12886},
+                /*54*/ {1,1,2,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,7,8,8,8,9,9,10,10,10,11,12,12,13,14,14,15,16,18,19,20,22,24,26,29,32,36,41,46,53,61,71,83,99,120,146,180,225,284,363,469,611,804,1067,1427,1924,2609,3560,4880,6721,9292},
+                /*55*/ {1,1,2,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,10,10,10,11,12,12,13,14,14,15,16,18,19,20,22,24,26,29,32,36,41,46,53,61,71,84,100,120,147,181,226,285,364,469,611,804,1068,1428,1925,2611,3561,4882,6724},
+                /*56*/ {1,1,2,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,10,10,11,11,12,12,13,14,15,15,17,18,19,21,22,24,27,29,32,36,41,46,53,61,71,84,100,120,147,181,226,285,364,470,612,805,1069,1430,1926,2612,3563,4884},
+                /*57*/ {1,1,2,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,14,15,16,17,18,19,21,22,24,27,29,33,36,41,46,53,61,71,84,100,121,147,181,226,286,365,470,613,806,1069,1431,1927,2614,3565},
+                /*58*/ {1,1,2,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,14,15,16,17,18,19,21,22,24,27,29,33,36,41,46,53,61,72,84,100,121,147,182,227,286,365,471,613,807,1070,1432,1929,2615},
+                /*59*/ {1,1,2,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,14,15,16,17,18,19,21,23,25,27,30,33,37,41,47,53,62,72,85,101,121,148,182,227,286,366,471,614,807,1071,1433,1930},
+                /*60*/ {1,1,2,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,14,15,16,17,18,19,21,23,25,27,30,33,37,41,47,53,62,72,85,101,121,148,182,227,287,366,472,615,808,1072,1434},
+                /*61*/ {1,1,2,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,14,15,16,17,18,19,21,23,25,27,30,33,37,41,47,54,62,72,85,101,122,148,183,228,287,366,472,615,809,1073},
+                /*62*/ {1,1,2,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,13,13,14,15,16,17,18,19,21,23,25,27,30,33,37,42,47,54,62,72,85,101,122,149,183,228,288,367,473,616,810},
+                /*63*/ {1,1,2,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,9,10,10,11,11,12,13,13,14,15,16,17,18,20,21,23,25,27,30,33,37,42,47,54,62,72,85,102,122,149,183,229,288,367,474,617},
+                /*64*/ {1,1,2,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,10,10,10,11,11,12,13,13,14,15,16,17,18,20,21,23,25,27,30,33,37,42,47,54,62,73,86,102,122,149,184,229,289,368,474},
+                /*65*/ {1,1,2,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,10,10,10,11,11,12,13,13,14,15,16,17,18,20,21,23,25,27,30,33,37,42,47,54,63,73,86,102,123,149,184,229,289,368},
+                /*66*/ {1,1,2,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,10,11,12,12,13,13,14,15,16,17,18,20,21,23,25,28,30,34,37,42,48,54,63,73,86,102,123,150,184,230,289},
+                /*67*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,14,14,15,16,17,18,20,21,23,25,28,30,34,38,42,48,55,63,73,86,102,123,150,185,230},
+                /*68*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,14,14,15,16,17,19,20,21,23,25,28,30,34,38,42,48,55,63,73,86,103,124,150,185},
+                /*69*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,14,14,15,16,17,19,20,22,23,25,28,31,34,38,42,48,55,63,74,87,103,124,151},
+                /*70*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,14,14,15,16,17,19,20,22,23,25,28,31,34,38,43,48,55,63,74,87,103,124},
+                /*71*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,9,10,10,11,11,12,12,13,14,15,15,16,17,19,20,22,23,26,28,31,34,38,43,48,55,64,74,87,103},
+                /*72*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,9,10,10,11,11,12,12,13,14,15,15,16,18,19,20,22,24,26,28,31,34,38,43,48,55,64,74,87},
+                /*73*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,9,10,10,11,11,12,12,13,14,15,16,17,18,19,20,22,24,26,28,31,34,38,43,49,55,64,74},
+                /*74*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,10,10,10,11,11,12,12,13,14,15,16,17,18,19,20,22,24,26,28,31,34,38,43,49,56,64},
+                /*75*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,7,8,8,8,9,9,9,10,10,10,11,11,12,13,13,14,15,16,17,18,19,20,22,24,26,28,31,35,38,43,49,56},
+                /*76*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,7,8,8,8,9,9,9,10,10,10,11,11,12,13,13,14,15,16,17,18,19,20,22,24,26,28,31,35,39,43,49},
+                /*77*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,7,8,8,8,9,9,9,10,10,10,11,11,12,13,13,14,15,16,17,18,19,21,22,24,26,29,31,35,39,43},
+                /*78*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,7,8,8,8,9,9,9,10,10,11,11,12,12,13,13,14,15,16,17,18,19,21,22,24,26,29,31,35,39},
+                /*79*/ {1,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,9,10,10,11,11,12,12,13,13,14,15,16,17,18,19,21,22,24,26,29,32,35},
+                /*80*/ {1,1,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,7,7,8,8,8,8,9,9,9,10,10,11,11,12,12,13,13,14,15,16,17,18,19,21,22,24,26,29,32},
+            },
+        };
+
+        // the index of ssp in gSsps or -1.
+        constexpr i64 sspIndex(u64 ssp)
+        {
+            for (u64 s = 0; s < gNumSsps; ++s)
+                if (gSsps[s] == ssp)
+                    return s;
+            return -1;
+        }
+
+        static_assert(gGridPoints[gNumPoints - 1] == gMaxPoint, "binSizeTable is inconsistent");
+        static_assert(gBinSizes[0][0][gNumPoints / 2] == gGridPoints[gNumPoints / 2], "one bin holds every ball");
+    }
+}
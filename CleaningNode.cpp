@@ -0,0 +1,116 @@
+// CleaningNode.cpp
+// 多方数据清洗的统一入口，取代原来的 party1 / partyi / partyn-1 / partyn。
+//
+//   cleaning_node <topology.conf> <party id>   运行其中一个参与方
+//   cleaning_node <topology.conf> all          在本进程中运行全部参与方（本机基准）
+//   cleaning_node <topology.conf> simulate <owners> <arity>[,<arity>...]
+//                                              本机模拟 k 叉汇总树，比较不同元数的延迟
+//   cleaning_node <topology.conf> netbench <MiB> <streams>[,<streams>...]
+//                                              本机测量条带化传输的 GB/s
+//   cleaning_node <topology.conf> membench <MiB> <senders>[,<senders>...]
+//                                              本机测量汇总方接收时的内存峰值
+//   cleaning_node <topology.conf> serve <party id>
+//                                              以常驻服务运行一个参与方；数据拥有方从
+//                                              stdin 逐行读取轮次号，EOF 时退出
+//   cleaning_node <topology.conf> rounds <N>   本机对比冷启动与常驻服务 N 轮的延迟
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Topology.h"
+#include "CleaningParty.h"
+
+using namespace std;
+
+int main(int argc, char** argv)
+{
+    string who = argc >= 3 ? argv[2] : "";
+    bool twoArgs = who == "serve" || who == "rounds";
+    if (!((argc == 3 && !twoArgs) || (argc == 4 && twoArgs) ||
+          (argc == 5 && (who == "simulate" || who == "netbench" || who == "membench")))) {
+        cerr << "usage: " << argv[0] << " <topology.conf> <party id | all>" << endl
+             << "       " << argv[0] << " <topology.conf> simulate <owners> <arity>[,<arity>...]" << endl
+             << "       " << argv[0] << " <topology.conf> netbench <MiB> <streams>[,<streams>...]" << endl
+             << "       " << argv[0] << " <topology.conf> membench <MiB> <senders>[,<senders>...]" << endl
+             << "       " << argv[0] << " <topology.conf> serve <party id>" << endl
+             << "       " << argv[0] << " <topology.conf> rounds <N>" << endl;
+        return 1;
+    }
+
+    Topology topo;
+    if (!topo.load(argv[1]))
+        return 1;
+
+    if (who == "simulate" || who == "netbench" || who == "membench") {
+        vector<uint64_t> list;
+        uint64_t n;
+        try {
+            n = std::stoull(argv[3]);
+            string s = argv[4];
+            for (size_t pos = 0; pos <= s.size();) {
+                auto comma = std::min(s.find(',', pos), s.size());
+                list.push_back(std::stoull(s.substr(pos, comma - pos)));
+                pos = comma + 1;
+            }
+        } catch (...) {
+            cerr << "invalid " << who << " arguments" << endl;
+            return 1;
+        }
+        if (who == "simulate")
+            return simulateTrees(topo, n, list) ? 0 : 1;
+        if (who == "membench")
+            return benchMemory(topo, n, list) ? 0 : 1;
+        return benchStreams(topo, n, list) ? 0 : 1;
+    }
+
+    if (who == "all")
+        return runAllParties(topo) ? 0 : 1;
+
+    if (who == "rounds") {
+        uint64_t n;
+        try {
+            n = std::stoull(argv[3]);
+        } catch (...) {
+            cerr << "invalid number of rounds: " << argv[3] << endl;
+            return 1;
+        }
+        return benchRounds(topo, n) ? 0 : 1;
+    }
+
+    if (topo.transport == Transport::InProc) {
+        cerr << "transport = inproc can only be used with 'all' or 'rounds'" << endl;
+        return 1;
+    }
+
+    string idArg = who == "serve" ? argv[3] : who;
+    uint64_t id;
+    try {
+        id = std::stoull(idArg);
+    } catch (...) {
+        cerr << "invalid party id: " << idArg << endl;
+        return 1;
+    }
+    if (who != "serve")
+        return runParty(topo, id) ? 0 : 1;
+
+    // 数据拥有方每读到一行就开始一轮，行内容为轮次号（空行时沿用上一轮加一）
+    RoundControl ctl;
+    uint64_t last = 0;
+    ctl.next = [&](uint64_t& round) {
+        string line;
+        if (!getline(cin, line))
+            return false;
+        try {
+            round = line.empty() ? last + 1 : std::stoull(line);
+        } catch (...) {
+            cerr << "invalid round id: " << line << endl;
+            return false;
+        }
+        last = round;
+        return true;
+    };
+    ctl.done = [](uint64_t round) {
+        cout << "[serve] round " << round << " done" << endl;
+    };
+    return serveParty(topo, id, ctl) ? 0 : 1;
+}
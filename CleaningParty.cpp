@@ -0,0 +1,1260 @@
+// CleaningParty.cpp
+#include "CleaningParty.h"
+#include "NodeNet.h"
+#include "OkvsTool.h"
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <algorithm>
+#include <functional>
+#include <cstring>
+#include <fstream>
+
+#include <malloc.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+using namespace std;
+using namespace osuCrypto;
+using namespace volePSI;
+
+namespace
+{
+    // 打印当前时刻（时:分:秒.毫秒），用于对比各方的收发时间
+    void printTimestamp(const string& tag)
+    {
+        auto now = std::chrono::system_clock::now();
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      now.time_since_epoch()) % 1000;
+
+        std::time_t t = std::chrono::system_clock::to_time_t(now);
+        std::tm local;
+        ::localtime_r(&t, &local);
+
+        std::cout << tag << " " << std::put_time(&local, "%H:%M:%S")
+                  << "." << std::setfill('0') << std::setw(3) << ms.count()
+                  << std::setfill(' ') << std::endl;
+    }
+
+    string tagOf(const PartyConfig& self)
+    {
+        return "[p" + std::to_string(self.id) + "]";
+    }
+
+    // 按 topo.io 选择 IoLoop 的后端
+    bool initLoop(IoLoop& loop, const Topology& topo, const string& tag)
+    {
+        if (loop.init(topo.io))
+            return true;
+        cerr << tag << " cannot start " << ioBackendName(topo.io) << " I/O loop" << endl;
+        return false;
+    }
+
+    // /proc/self/status 中的一项，单位 kB，读不到时为 0
+    uint64_t procStatusKb(const string& key)
+    {
+        std::ifstream in("/proc/self/status");
+        string line;
+        while (getline(in, line))
+            if (line.compare(0, key.size(), key) == 0 && line.size() > key.size() && line[key.size()] == ':')
+                return std::strtoull(line.c_str() + key.size() + 1, nullptr, 10);
+        return 0;
+    }
+
+    // 进程 RSS 的峰值（VmHWM），单位 MiB
+    double peakRssMiB()
+    {
+        return procStatusKb("VmHWM") / 1024.0;
+    }
+
+    // 把空闲的堆内存还给系统，再把 VmHWM 重置为当前 RSS，返回当前 RSS（MiB）
+    double resetPeakRss()
+    {
+        ::malloc_trim(0);
+        std::ofstream("/proc/self/clear_refs") << "5";
+        return procStatusKb("VmRSS") / 1024.0;
+    }
+
+    // 所有参与方必须使用相同的 PaxosParam，D 才能逐元素异或
+    PaxosParam paramOf(const Topology& topo, uint64_t numKeys)
+    {
+        return PaxosParam(topo.numItems ? topo.numItems : numKeys, topo.weight, topo.ssp, topo.dt);
+    }
+
+    // 中间节点与汇总方的连接。一次性运行时每轮（只有一轮）都边 accept 边接收；
+    // 常驻服务（persistent）保留第一轮 accept 到的子节点连接和发往 parent 的
+    // 条带，之后各轮直接在这些连接上收发
+    struct Links
+    {
+        IoLoop loop;
+        NodeListener listener;
+        vector<int> children;
+        vector<int> parent;
+        vector<oc::Matrix<block>> buffers;      // 上一轮收完的 D，下一轮接收时复用
+        bool persistent = false;
+
+        ~Links()
+        {
+            closeSockets(children);
+            closeSockets(parent);
+        }
+
+        bool open(const Topology& topo, const PartyConfig& self)
+        {
+            auto tag = tagOf(self);
+            if (!listener.open(topo, self, int(self.fanIn * topo.streams))) {
+                cerr << tag << " listen failed" << endl;
+                return false;
+            }
+            return initLoop(loop, topo, tag);
+        }
+
+        void startReceive(MatrixReceiver& rcv, const PartyConfig& self, size_t count,
+                          MatrixReceiver::OnMatrix onMatrix, MatrixReceiver::OnRows onRows = nullptr)
+        {
+            if (persistent)
+                rcv.reuseBuffers(buffers);
+            if (!children.empty()) {
+                rcv.start(loop, children, self.id, count, std::move(onMatrix), std::move(onRows));
+                return;
+            }
+            if (persistent)
+                rcv.keepConns();
+            rcv.start(loop, listener, count, std::move(onMatrix), std::move(onRows));
+        }
+
+        void endReceive(MatrixReceiver& rcv)
+        {
+            if (persistent && children.empty())
+                children = rcv.takeConns();
+        }
+
+        // 本轮用完的 D 留给下一轮的接收，省去重新分配与缺页
+        void recycle(oc::Matrix<block>& M)
+        {
+            if (persistent && M.size())
+                buffers.push_back(std::move(M));
+            M = oc::Matrix<block>();
+        }
+    };
+
+    // 要发送的 D：内存中的矩阵（可能仍在编码），或已经写好的 OkvsFile
+    struct DSource
+    {
+        const oc::Matrix<block>* M = nullptr;
+        const OkvsFile* file = nullptr;
+        int fd = -1;
+    };
+
+    // 在 loop 上用已经连上 parent 的 socks 发送一轮的 D。produce 在另一个线程中
+    // 生成 D 并把完成的行提交给 sender，本线程运行 loop 把它们发出去，编码与发送
+    // 重叠；D 已经算好时只需提交 [0, rows)。socks 留给调用方关闭或用于下一轮。
+    bool sendD(const Topology& topo, const PartyConfig& self, IoLoop& loop, const vector<int>& socks,
+               uint64_t round, const DSource& src, const std::function<bool(MatrixStreamSender&)>& produce)
+    {
+        auto tag = tagOf(self);
+        MatrixStreamSender sender;
+        sender.useZeroCopy(topo.zeroCopy);
+        sender.setRound(round);
+        auto start = std::chrono::steady_clock::now();
+        if (src.file) {
+            sender.useFile(src.fd, src.file->header().dataOffset);
+            sender.start(loop, socks, self.id, src.file->matrix());
+        } else {
+            sender.start(loop, socks, self.id, *src.M);
+        }
+
+        std::chrono::steady_clock::time_point producedAt;
+        auto producer = std::async(std::launch::async, [&] {
+            // produce 抛出异常时也要 close，否则 finish() 一直等待不会再提交的行；
+            // 未提交完的 D 会让 finish() 返回 false
+            struct CloseSender
+            {
+                MatrixStreamSender& s;
+                ~CloseSender() { s.close(); }
+            } closeSender{ sender };
+            bool ok = produce(sender);
+            producedAt = std::chrono::steady_clock::now();
+            return ok;
+        });
+        bool sent = sender.finish();
+        auto lastByte = std::chrono::steady_clock::now();
+        bool produced = false;
+        try {
+            produced = producer.get();
+        } catch (const std::exception& e) {
+            cerr << tag << " produce D failed: " << e.what() << endl;
+        }
+
+        if (!produced)
+            return false;
+        if (!sent) {
+            cerr << tag << " send D failed" << endl;
+            return false;
+        }
+
+        auto bytes = src.file ? src.file->header().dataBytes : src.M->size() * sizeof(block);
+        auto ms = [&](auto t) { return std::chrono::duration<double, std::milli>(t - start).count(); };
+        cout << tag << " Sent D to party " << self.parent << " over " << topo.streams << " stream(s), bytes = "
+             << bytes << ", " << sender.modeString() << endl;
+        cout << tag << " produce " << ms(producedAt) << " ms, first send at " << sender.firstSendMs()
+             << " ms, last byte at " << ms(lastByte) << " ms, sender CPU " << sender.cpuMs() << " ms" << endl;
+        return true;
+    }
+
+    // 一次性运行：用 topo.streams 条连接把 D 发给 parent，见 sendD
+    bool streamToParent(const Topology& topo, const PartyConfig& self, const DSource& src,
+                        const std::function<bool(MatrixStreamSender&)>& produce)
+    {
+        auto tag = tagOf(self);
+        auto socks = connectStreams(topo, self.parent);
+        if (socks.empty()) {
+            cerr << tag << " connect to party " << self.parent << " failed" << endl;
+            return false;
+        }
+        printTimestamp(tag);
+
+        IoLoop loop;
+        bool ok = initLoop(loop, topo, tag) && sendD(topo, self, loop, socks, 0, src, produce);
+        closeSockets(socks);
+        return ok;
+    }
+
+    // 数据拥有方的 okvsFile 已存在、且正是由当前的 keys 和参数编码得到时直接发送该文件。
+    // 只需读 keys 求摘要，不生成 values、不编码。文件与当前输入不符时 sentFromFile
+    // 为 false，调用者重新编码并覆盖该文件
+    bool sendOkvsFile(const Topology& topo, const PartyConfig& self, bool& sentFromFile)
+    {
+        sentFromFile = false;
+        if (self.okvsFile.empty() || ::access(self.okvsFile.c_str(), R_OK) != 0)
+            return true;
+
+        auto tag = tagOf(self);
+        OkvsFile file;
+        if (!file.open(self.okvsFile, false, false))
+            return false;
+        auto& h = file.header();
+
+        vector<block> keys;
+        if (!loadKeysFromCsv(keys, self.keyPath))
+            return false;
+        if (!okvsFileMatches(file, keys, topo.bits, paramOf(topo, keys.size()), topo.seed, topo.engine)) {
+            cout << tag << " " << self.okvsFile
+                 << " was encoded from other keys or parameters, re-encoding" << endl;
+            return true;
+        }
+
+        int fd = ::open(self.okvsFile.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            perror("open");
+            return false;
+        }
+        cout << tag << " Sending D from " << self.okvsFile << " (" << h.rows << " x " << h.cols << ")" << endl;
+        bool ok = streamToParent(topo, self, DSource{ nullptr, &file, fd }, [&](MatrixStreamSender& sender) {
+            sender.submit(0, h.rows);
+            return true;
+        });
+        ::close(fd);
+        sentFromFile = ok;
+        return ok;
+    }
+
+    // 接收一轮的 fanIn 个 D 并异或到 acc。由 OKVS 的线性性，
+    // Decode(D1 ^ D2, k) = Decode(D1, k) ^ Decode(D2, k)，
+    // 因此中间节点只需向上转发一个 D，每条边上的数据量与参与方个数无关。
+    // 各子节点的 D 由 MatrixReceiver 并发接收，哪个先收完就先异或哪个，
+    // 接收耗时取决于最慢的子节点。topo.bounded 时不保留各子节点的 D，
+    // 收到的每一段直接异或进 acc。常驻服务的子节点全部退出时 closed 为 true。
+    bool receiveXor(const Topology& topo, const PartyConfig& self, Links& links,
+                    oc::Matrix<block>& acc, uint64_t& round, bool& closed)
+    {
+        auto tag = tagOf(self);
+        if (links.children.empty())
+            cout << tag << " Waiting for " << self.fanIn << " D(s) on port " << self.port << " ..." << endl;
+        if (!topo.bounded)
+            links.recycle(acc);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        double xorMs = 0;
+        bool first = true;
+        MatrixReceiver receiver;
+        if (topo.bounded)
+            receiver.foldInto(acc);
+        links.startReceive(receiver, self, self.fanIn, [&](size_t i, oc::Matrix<block>& D) {
+            printTimestamp(tag);
+            if (topo.bounded) {
+                cout << tag << " D" << (i + 1) << " folded: " << acc.rows() << " x " << acc.cols() << endl;
+                return true;
+            }
+            double MB = D.size() * sizeof(block) / (1024.0 * 1024.0);
+            cout << tag << " D" << (i + 1) << " received: " << D.rows() << " x " << D.cols()
+                 << " (" << MB << " MB)" << endl;
+
+            if (first) {
+                first = false;
+                acc = std::move(D);
+                return true;
+            }
+            if (D.rows() != acc.rows() || D.cols() != acc.cols()) {
+                cerr << tag << " D" << (i + 1) << " has shape " << D.rows() << "x" << D.cols()
+                     << ", expected " << acc.rows() << "x" << acc.cols()
+                     << " (set numItems so that all parties use the same PaxosParam)" << endl;
+                return false;
+            }
+
+            auto xorStart = std::chrono::high_resolution_clock::now();
+            auto dst = acc.data();
+            auto src = D.data();
+            for (uint64_t j = 0; j < acc.size(); ++j)
+                dst[j] = dst[j] ^ src[j];
+            auto xorEnd = std::chrono::high_resolution_clock::now();
+            xorMs += std::chrono::duration_cast<std::chrono::microseconds>(xorEnd - xorStart).count() / 1000.0;
+            links.recycle(D);
+            return true;
+        });
+        links.loop.run([&] { return receiver.done(); });
+        closed = receiver.closed();
+        if (closed)
+            return true;
+        if (!receiver.ok()) {
+            cerr << tag << " receive D failed" << endl;
+            return false;
+        }
+        links.endReceive(receiver);
+        round = receiver.round();
+
+        auto end = std::chrono::high_resolution_clock::now();
+        double recvMs = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+        if (links.persistent)
+            cout << tag << " Round " << round << ":";
+        else
+            cout << tag;
+        cout << " Receive Time cost: " << std::fixed << std::setprecision(3) << recvMs << " ms";
+        if (topo.bounded)
+            cout << ", XOR folded into the receive";
+        else if (self.fanIn > 1)
+            cout << ", XOR Time cost: " << xorMs << " ms";
+        cout << std::defaultfloat << " (" << links.loop.statsString() << ")" << endl;
+        return true;
+    }
+
+    // 数据拥有方：keys -> values -> D，发给 parent
+    bool runOwner(const Topology& topo, const PartyConfig& self)
+    {
+        auto tag = tagOf(self);
+
+        // 0. D 已经编码好并保存在 okvsFile 中时，不需要 values 和编码
+        bool sentFromFile;
+        if (!sendOkvsFile(topo, self, sentFromFile))
+            return false;
+        if (sentFromFile) {
+            cout << tag << " Done." << endl;
+            return true;
+        }
+
+        vector<block> keys;
+        oc::Matrix<block> vals;
+        std::future<bool> valSaved;
+
+        // 1. 载入 keys，并根据 key 生成 values
+        if (!loadKeysAndGenerateValues(keys, vals, self.keyPath, self.valPath, &valSaved)) {
+            cerr << tag << " loadKeysAndGenerateValues failed" << endl;
+            return false;
+        }
+
+        // 2. 先连上 parent，再边编码边发送 D：已完成的前缀（Baxos 按 bin 推进）
+        //    立即发出，最后一个字节的时刻趋近 max(编码, 传输) 而不是两者之和
+        PaxosParam pp = paramOf(topo, keys.size());
+        oc::Matrix<block> D;
+        bool ok = streamToParent(topo, self, DSource{ &D }, [&](MatrixStreamSender& sender) {
+            if (!encodeOKVS_streamed(topo.bits, keys, vals, D, pp,
+                    [&sender](u64 begin, u64 end) { sender.submit(begin, end); },
+                    topo.seed, topo.engine, topo.rowCacheDir)) {
+                cerr << tag << " encodeOKVS_streamed failed" << endl;
+                return false;
+            }
+            cout << tag << " D encoded: " << D.rows() << " x " << D.cols() << endl;
+            return true;
+        });
+        if (!ok)
+            return false;
+
+        // 3. 保存 D，下次直接从文件发送
+        if (!self.okvsFile.empty() &&
+            !saveOKVSToFile(D, self.okvsFile, topo.bits, keys, pp, topo.seed, topo.engine))
+            cerr << tag << " failed to save " << self.okvsFile << endl;
+
+        if (valSaved.valid() && !valSaved.get())
+            cerr << tag << " failed to save " << self.valPath << endl;
+
+        cout << tag << " Done." << endl;
+        return true;
+    }
+
+    // 中间节点的一轮：fanIn 个 D 异或成一个，发给 parent。所有子节点都已收到的行
+    // 立即异或进 acc 并提交给发往 parent 的 sender；接收、异或、发送都在同一个
+    // IoLoop 线程中进行，互相重叠，最后一个字节到达后只剩最后一块要转发。
+    // 转发时沿用子节点连接头中的轮次号。常驻服务的子节点全部退出时 closed 为 true。
+    bool relayRound(const Topology& topo, const PartyConfig& self, Links& links,
+                    oc::Matrix<block>& acc, bool& closed)
+    {
+        using Clock = std::chrono::steady_clock;
+        auto tag = tagOf(self);
+        auto fanIn = self.fanIn;
+
+        vector<oc::Matrix<block>> tables;       // 收完的 D，转发完之前保留其缓冲区
+        vector<const block*> data(fanIn, nullptr);
+        vector<uint64_t> rowsIn(fanIn, 0);
+        bool shaped = false;
+        uint64_t xored = 0;
+        double xorMs = 0;
+        auto start = Clock::now();
+        auto firstByte = start, lastByte = start;
+
+        MatrixStreamSender sender;
+        sender.useZeroCopy(topo.zeroCopy);
+        sender.start(links.loop, links.parent, self.id, acc);
+        MatrixReceiver receiver;
+
+        auto onRows = [&](size_t t, oc::Matrix<block>& M, uint64_t n) {
+            if (!data[t]) {
+                if (!shaped) {
+                    // acc 的形状不变时沿用上一轮的缓冲区；bounded 时 acc 由 receiver 清零并累加
+                    if (!topo.bounded && (acc.rows() != M.rows() || acc.cols() != M.cols()))
+                        acc.resize(M.rows(), M.cols(), oc::AllocType::Uninitialized);
+                    shaped = true;
+                    firstByte = Clock::now();
+                    sender.setRound(receiver.round());
+                } else if (M.rows() != acc.rows() || M.cols() != acc.cols()) {
+                    cerr << tag << " D" << (t + 1) << " has shape " << M.rows() << "x" << M.cols()
+                         << ", expected " << acc.rows() << "x" << acc.cols()
+                         << " (set numItems so that all parties use the same PaxosParam)" << endl;
+                    return false;
+                }
+                data[t] = M.data();
+            }
+            rowsIn[t] = n;
+            if (std::find(data.begin(), data.end(), nullptr) != data.end())
+                return true;
+
+            // bounded 时所有子节点都已并入的行即为结果
+            auto ready = *std::min_element(rowsIn.begin(), rowsIn.end());
+            if (ready == xored)
+                return true;
+            if (!topo.bounded) {
+                auto xorStart = Clock::now();
+                auto dst = acc.data();
+                for (auto j = xored * acc.cols(); j < ready * acc.cols(); ++j) {
+                    auto v = data[0][j];
+                    for (uint64_t k = 1; k < fanIn; ++k)
+                        v = v ^ data[k][j];
+                    dst[j] = v;
+                }
+                xorMs += std::chrono::duration<double, std::milli>(Clock::now() - xorStart).count();
+            }
+            sender.submit(xored, ready);
+            xored = ready;
+            return true;
+        };
+        auto onMatrix = [&](size_t i, oc::Matrix<block>& M) {
+            printTimestamp(tag);
+            cout << tag << " D" << (i + 1) << (topo.bounded ? " folded: " : " received: ")
+                 << acc.rows() << " x " << acc.cols() << endl;
+            tables.push_back(std::move(M));
+            if (i + 1 == fanIn)
+                lastByte = Clock::now();
+            return true;
+        };
+
+        if (topo.bounded)
+            receiver.foldInto(acc);
+        links.startReceive(receiver, self, fanIn, onMatrix, onRows);
+        links.loop.run([&] { return receiver.done(); });
+        closed = receiver.closed();
+        if (closed)
+            return true;
+        sender.close();
+        bool sent = sender.finish();
+        auto end = Clock::now();
+        for (auto& M : tables)
+            links.recycle(M);
+
+        if (!receiver.ok()) {
+            cerr << tag << " receive D failed" << endl;
+            return false;
+        }
+        if (!sent) {
+            cerr << tag << " send D failed" << endl;
+            return false;
+        }
+        links.endReceive(receiver);
+
+        auto ms = [](Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+        if (links.persistent)
+            cout << tag << " Round " << receiver.round() << ":";
+        else
+            cout << tag;
+        cout << " Receive Time cost: " << ms(lastByte - (links.persistent ? firstByte : start)) << " ms";
+        if (topo.bounded)
+            cout << ", XOR folded into the receive" << endl;
+        else
+            cout << ", XOR Time cost: " << xorMs << " ms (overlapped)" << endl;
+        cout << tag << " Forwarded D to party " << self.parent << " over " << topo.streams << " stream(s), "
+             << sender.modeString() << ", last byte " << ms(end - lastByte) << " ms after the last byte received"
+             << " (" << links.loop.statsString() << ")" << endl;
+        return true;
+    }
+
+    // 中间节点。serve 时作为常驻服务逐轮转发，直到子节点全部退出
+    bool runRelay(const Topology& topo, const PartyConfig& self, bool serve)
+    {
+        auto tag = tagOf(self);
+        Links links;
+        links.persistent = serve;
+        if (!links.open(topo, self))
+            return false;
+        cout << tag << " Waiting for " << self.fanIn << " D(s) on port " << self.port << " ..." << endl;
+
+        // 先连上 parent；子节点的连接在此期间留在 backlog 中
+        links.parent = connectStreams(topo, self.parent);
+        if (links.parent.empty()) {
+            cerr << tag << " connect to party " << self.parent << " failed" << endl;
+            return false;
+        }
+
+        oc::Matrix<block> acc;
+        bool closed = false;
+        do {
+            if (!relayRound(topo, self, links, acc, closed))
+                return false;
+        } while (serve && !closed);
+
+        cout << tag << " Done." << endl;
+        return true;
+    }
+
+    void printXorVals(const string& tag, const oc::Matrix<block>& xorVals)
+    {
+        cout << tag << " Decode OK. Show first 3 values:" << endl;
+        for (size_t i = 0; i < std::min<size_t>(3, xorVals.rows()); ++i)
+            cout << tag << " xorVals[" << i << "] = " << xorVals(i, 0) << endl;
+    }
+
+    // topo.matchFile 非空时筛出 values 异或等于 matchTarget 的行并写入文件，
+    // 常驻服务每轮写一个 <matchFile>.<round>
+    bool emitMatches(const Topology& topo, const string& tag, const vector<block>& keys,
+                     const oc::Matrix<block>& xorVals, uint64_t round, bool persistent)
+    {
+        if (topo.matchFile.empty())
+            return true;
+
+        auto start = std::chrono::steady_clock::now();
+        block target(0, topo.matchTarget);
+        vector<uint64_t> idx;
+        auto n = matchRows(oc::MatrixView<const block>(xorVals.data(), xorVals.rows(), xorVals.cols()), target, idx);
+        double scanMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        string path = persistent ? topo.matchFile + "." + std::to_string(round) : topo.matchFile;
+        if (!writeMatches(path, topo.matchFormat, idx, keys, target))
+            return false;
+        double totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        cout << tag << " " << n << " of " << xorVals.rows() << " rows match, scan " << scanMs << " ms ("
+             << xorVals.size() * sizeof(block) / (scanMs * 1e6) << " GB/s, " << matchBackend()
+             << "), scan + write " << totalMs << " ms -> " << path << endl;
+        return true;
+    }
+
+    // Baxos 汇总方的一轮：边收 D 边解码。所有子节点的 D 都收到某个 bin 的行后，
+    // 把它们在该 bin 上的切片异或到第一个 D 上，并立即解码该 bin 的 keys。
+    // 由于 bin 在 D 中连续且各方按行号顺序发送，解码与传输重叠，最后一个字节
+    // 到达后只剩少量 bin 要解。binned 完成之前不会开始解码（第一轮中 keys 的
+    // 分组与等待连接重叠）。topo.bounded 时各子节点的 D 边收边异或进 acc，
+    // 所有子节点都并入某个 bin 的行后直接解码该 bin。
+    bool streamingRound(const Topology& topo, const PartyConfig& self, Links& links,
+                        BaxosBinDecoder& dec, std::shared_future<bool>& binned, const vector<block>& keys,
+                        oc::Matrix<block>& acc, oc::Matrix<block>& xorVals, uint64_t& round, bool& closed)
+    {
+        using Clock = std::chrono::steady_clock;
+        auto tag = tagOf(self);
+        auto fanIn = self.fanIn;
+        auto waitStart = Clock::now();
+
+        // 1. 各连接已收到的行数；所有连接都到齐的 bin 数为 readyBins
+        std::mutex mtx;
+        std::condition_variable cv;
+        vector<block*> data(fanIn, nullptr);
+        vector<uint64_t> rowsIn(fanIn, 0);
+        uint64_t rows = 0, cols = 0, readyBins = 0, nextBin = 0;
+        bool recvDone = false;
+        std::atomic<bool> failed(false);
+        vector<oc::Matrix<block>> tables;
+
+        Clock::time_point firstByte = waitStart, lastByte = waitStart;
+        struct Span { Clock::time_point begin, end; };
+        vector<Span> spans;
+
+        auto worker = [&] {
+            if (!binned.get()) {
+                failed = true;
+                return;
+            }
+            while (true) {
+                uint64_t bin;
+                {
+                    std::unique_lock<std::mutex> lock(mtx);
+                    cv.wait(lock, [&] { return nextBin < readyBins || recvDone || failed; });
+                    if (nextBin == readyBins || failed)
+                        return;
+                    bin = nextBin++;
+                }
+
+                Span sp;
+                sp.begin = Clock::now();
+                try {
+                    auto b = bin * dec.binRows() * cols;
+                    auto e = b + dec.binRows() * cols;
+                    for (uint64_t t = 1; t < fanIn && !topo.bounded; ++t)
+                        for (auto j = b; j < e; ++j)
+                            data[0][j] = data[0][j] ^ data[t][j];
+                    dec.decodeBin(bin, oc::MatrixView<const block>(data[0], rows, cols),
+                                  oc::MatrixView<block>(xorVals.data(), xorVals.rows(), cols));
+                } catch (const std::exception& ex) {
+                    cerr << tag << " decode bin " << bin << " failed: " << ex.what() << endl;
+                    failed = true;
+                    cv.notify_all();
+                    return;
+                }
+                sp.end = Clock::now();
+
+                std::lock_guard<std::mutex> lock(mtx);
+                spans.push_back(sp);
+            }
+        };
+
+        auto numWorkers = std::max<size_t>(1, std::thread::hardware_concurrency());
+        vector<std::thread> thrds(numWorkers);
+        for (auto& th : thrds)
+            th = std::thread(worker);
+
+        // 2. 接收。新到的行使更多 bin 在所有连接上到齐时唤醒解码线程
+        auto onRows = [&](size_t conn, oc::Matrix<block>& M, uint64_t n) {
+            if (failed)
+                return false;
+            std::lock_guard<std::mutex> lock(mtx);
+            if (data[conn] == nullptr) {
+                if (rows == 0) {
+                    // 第一个到达的 D 决定形状；解码前需要 keys 已分好组
+                    firstByte = Clock::now();
+                    if (!binned.get())
+                        return false;
+                    rows = M.rows();
+                    cols = M.cols();
+                    if (rows != dec.rows()) {
+                        cerr << tag << " D has " << rows << " rows, expected " << dec.rows()
+                             << " (set numItems so that all parties use the same PaxosParam)" << endl;
+                        return false;
+                    }
+                    if (xorVals.rows() != keys.size() || xorVals.cols() != cols)
+                        xorVals.resize(keys.size(), cols, oc::AllocType::Uninitialized);
+                } else if (M.rows() != rows || M.cols() != cols) {
+                    cerr << tag << " D" << (conn + 1) << " has shape " << M.rows() << "x" << M.cols()
+                         << ", expected " << rows << "x" << cols << endl;
+                    return false;
+                }
+                data[conn] = M.data();
+            }
+
+            rowsIn[conn] = n;
+            auto ready = *std::min_element(rowsIn.begin(), rowsIn.end()) / dec.binRows();
+            if (ready > readyBins) {
+                readyBins = ready;
+                cv.notify_all();
+            }
+            return true;
+        };
+        auto onMatrix = [&](size_t i, oc::Matrix<block>& M) {
+            printTimestamp(tag);
+            cout << tag << " D" << (i + 1) << (topo.bounded ? " folded: " : " received: ")
+                 << rows << " x " << cols << endl;
+            tables.push_back(std::move(M));     // 解码线程仍在使用其缓冲区
+            if (i + 1 == fanIn)
+                lastByte = Clock::now();
+            return true;
+        };
+        MatrixReceiver receiver;
+        if (topo.bounded)
+            receiver.foldInto(acc);
+        links.startReceive(receiver, self, fanIn, onMatrix, onRows);
+        links.loop.run([&] { return receiver.done(); });
+        closed = receiver.closed();
+        bool ok = closed || receiver.ok();
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            recvDone = true;
+            if (!ok)
+                failed = true;
+            cv.notify_all();
+        }
+        for (auto& th : thrds)
+            th.join();
+        auto decodeDone = Clock::now();
+        for (auto& M : tables)
+            links.recycle(M);
+        if (closed)
+            return true;
+
+        if (!ok || failed || nextBin != dec.numBins()) {
+            cerr << tag << " streaming receive/decode failed" << endl;
+            return false;
+        }
+        links.endReceive(receiver);
+        round = receiver.round();
+
+        // 3. 统计解码与传输的重叠：解码忙时中落在最后一个字节到达之前的比例
+        auto ms = [](Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+        double busy = 0, overlapped = 0;
+        for (auto& sp : spans) {
+            busy += ms(sp.end - sp.begin);
+            if (sp.begin < lastByte)
+                overlapped += ms(std::min(sp.end, lastByte) - sp.begin);
+        }
+        if (links.persistent)
+            cout << tag << " Round " << round << ":";
+        else
+            cout << tag;
+        cout << " Streaming decode: " << dec.numBins() << " bins, " << numWorkers << " threads" << endl;
+        cout << tag << " wait for first byte " << ms(firstByte - waitStart) << " ms, transfer "
+             << ms(lastByte - firstByte) << " ms, decode busy " << busy << " ms ("
+             << (busy > 0 ? 100.0 * overlapped / busy : 0.0) << "% overlapped with transfer), done "
+             << ms(decodeDone - lastByte) << " ms after last byte" << endl;
+        return true;
+    }
+
+    // Baxos 汇总方。等待连接时载入 keys 并按 bin 分组；ctl 非空时作为常驻服务
+    // 逐轮解码，分组结果在各轮之间复用，每轮解完后调用 ctl->done
+    bool runStreamingAggregator(const Topology& topo, const PartyConfig& self, const RoundControl* ctl)
+    {
+        auto tag = tagOf(self);
+        Links links;
+        links.persistent = ctl != nullptr;
+        if (!links.open(topo, self))
+            return false;
+        cout << tag << " Waiting for " << self.fanIn << " D(s) on port " << self.port
+             << " (streaming decode) ..." << endl;
+
+        vector<block> keys;
+        BaxosBinDecoder dec;
+        std::shared_future<bool> binned = std::async(std::launch::async, [&] {
+            if (!loadKeysFromCsv(keys, self.keyPath)) {
+                cerr << tag << " loadKeysFromCsv failed" << endl;
+                return false;
+            }
+            PaxosParam pp = paramOf(topo, keys.size());
+            dec.init(keys, pp, topo.seed);
+            return true;
+        }).share();
+
+        oc::Matrix<block> acc, xorVals;
+        uint64_t round = 0;
+        bool closed = false;
+        while (true) {
+            bool ok = streamingRound(topo, self, links, dec, binned, keys, acc, xorVals, round, closed);
+            if (!ok || closed) {
+                // 未开始接收就失败时，后台的分组仍在引用本函数的局部变量
+                binned.wait();
+                if (!ok)
+                    return false;
+                break;
+            }
+            printXorVals(tag, xorVals);
+            if (!emitMatches(topo, tag, keys, xorVals, round, ctl != nullptr))
+                return false;
+            if (!ctl)
+                break;
+            if (ctl->done)
+                ctl->done(round);
+        }
+
+        cout << tag << " Done." << endl;
+        return true;
+    }
+
+    // 汇总方：fanIn 个 D 异或后解码一次，得到各方 values 的异或。
+    // 等待连接与接收 D 的同时在后台载入 keys 并哈希成行，最后一个字节到达后
+    // 只剩按行取出 D 中的位置求和。ctl 非空时作为常驻服务逐轮解码，
+    // 每轮解完后调用 ctl->done
+    bool runAggregator(const Topology& topo, const PartyConfig& self, const RoundControl* ctl = nullptr)
+    {
+        using Clock = std::chrono::steady_clock;
+        auto tag = tagOf(self);
+        if (topo.engine == OkvsEngine::Baxos)
+            return runStreamingAggregator(topo, self, ctl);
+
+        Links links;
+        links.persistent = ctl != nullptr;
+        if (!links.open(topo, self))
+            return false;
+
+        // 接收方只需要 keys，不生成 values
+        vector<block> keys;
+        OkvsKeySet ks;
+        auto prepared = std::async(std::launch::async, [&] {
+            if (!loadKeysFromCsv(keys, self.keyPath)) {
+                cerr << tag << " loadKeysFromCsv failed" << endl;
+                return false;
+            }
+            PaxosParam pp = paramOf(topo, keys.size());
+            return ks.init(topo.bits, keys, pp, topo.seed, topo.engine, false, topo.rowCacheDir);
+        });
+
+        oc::Matrix<block> D, xorVals;
+        uint64_t round = 0;
+        bool closed = false;
+        while (true) {
+            if (!receiveXor(topo, self, links, D, round, closed))
+                return false;
+            if (closed)
+                break;
+
+            // 只有第一轮可能需要等 keys 准备好
+            if (prepared.valid()) {
+                auto waitStart = Clock::now();
+                if (!prepared.get())
+                    return false;
+                cout << tag << " waited " << std::chrono::duration<double, std::milli>(Clock::now() - waitStart).count()
+                     << " ms for key preparation after the last byte" << endl;
+            }
+            if (!ks.decode(D, xorVals)) {
+                cerr << tag << " round " << round << " decode failed" << endl;
+                return false;
+            }
+            printXorVals(tag, xorVals);
+            if (!emitMatches(topo, tag, keys, xorVals, round, ctl != nullptr))
+                return false;
+            if (!ctl)
+                break;
+            if (ctl->done)
+                ctl->done(round);
+        }
+
+        cout << tag << " Done." << endl;
+        return true;
+    }
+
+    // 常驻的数据拥有方：keys 只载入、预处理一次，连向 parent 的条带在各轮之间保留。
+    // 每轮由 ctl.next 给出轮次号，按轮次号重新生成 values，用预处理好的 keys 编码
+    // 并边编码边发送；ctl.next 返回 false 时关闭连接，上游据此依次退出
+    bool serveOwner(const Topology& topo, const PartyConfig& self, const RoundControl& ctl)
+    {
+        using Clock = std::chrono::steady_clock;
+        auto tag = tagOf(self);
+
+        vector<block> keys;
+        if (!loadKeysFromCsv(keys, self.keyPath)) {
+            cerr << tag << " loadKeysFromCsv failed" << endl;
+            return false;
+        }
+        PaxosParam pp = paramOf(topo, keys.size());
+        OkvsKeySet ks;
+        if (!ks.init(topo.bits, keys, pp, topo.seed, topo.engine, true, topo.rowCacheDir))
+            return false;
+
+        auto socks = connectStreams(topo, self.parent);
+        if (socks.empty()) {
+            cerr << tag << " connect to party " << self.parent << " failed" << endl;
+            return false;
+        }
+        IoLoop loop;
+        bool ok = initLoop(loop, topo, tag);
+
+        oc::Matrix<block> vals, D;
+        uint64_t round = 0;
+        while (ok && ctl.next && ctl.next(round)) {
+            auto start = Clock::now();
+            generateValues(keys, vals, ValuePrf::Aes, 0, round);
+            ok = sendD(topo, self, loop, socks, round, DSource{ &D }, [&](MatrixStreamSender& sender) {
+                if (!ks.encode(vals, D, [&sender](u64 begin, u64 end) { sender.submit(begin, end); })) {
+                    cerr << tag << " round " << round << " encode failed" << endl;
+                    return false;
+                }
+                return true;
+            });
+            if (ok)
+                cout << tag << " Round " << round << " values + encode + send: "
+                     << std::chrono::duration<double, std::milli>(Clock::now() - start).count() << " ms" << endl;
+        }
+        closeSockets(socks);
+
+        if (ok)
+            cout << tag << " Done." << endl;
+        return ok;
+    }
+}
+
+bool runParty(const Topology& topo, uint64_t id)
+{
+    auto self = topo.find(id);
+    if (!self) {
+        cerr << "runParty: party " << id << " is not in the topology" << endl;
+        return false;
+    }
+
+    switch (self->role) {
+    case PartyRole::Owner: return runOwner(topo, *self);
+    case PartyRole::Relay: return runRelay(topo, *self, false);
+    default:               return runAggregator(topo, *self);
+    }
+}
+
+bool serveParty(const Topology& topo, uint64_t id, const RoundControl& ctl)
+{
+    auto self = topo.find(id);
+    if (!self) {
+        cerr << "serveParty: party " << id << " is not in the topology" << endl;
+        return false;
+    }
+
+    switch (self->role) {
+    case PartyRole::Owner: return serveOwner(topo, *self, ctl);
+    case PartyRole::Relay: return runRelay(topo, *self, true);
+    default:               return runAggregator(topo, *self, &ctl);
+    }
+}
+
+bool runAllParties(const Topology& topo, double* elapsedMs)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    std::atomic<bool> ok(true);
+    vector<std::thread> thrds;
+    for (auto& p : topo.parties)
+        thrds.emplace_back([&, id = p.id] {
+            if (!runParty(topo, id))
+                ok = false;
+        });
+    for (auto& th : thrds)
+        th.join();
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    cout << "[all] " << topo.parties.size() << " parties finished in " << ms << " ms, peak RSS "
+         << peakRssMiB() << " MiB" << (ok ? "" : " (with failures)") << endl;
+    if (elapsedMs)
+        *elapsedMs = ms;
+    return ok;
+}
+
+bool simulateTrees(const Topology& base, uint64_t numOwners, const std::vector<uint64_t>& arities)
+{
+    struct Row { uint64_t arity, depth, relays; double ms; bool ok; };
+    vector<Row> rows;
+
+    for (auto arity : arities) {
+        Topology topo = base;
+        if (!topo.buildTree(numOwners, arity))
+            return false;
+
+        Row r{ arity, topo.depth(), topo.parties.size() - numOwners - 1, 0, false };
+        cout << "[simulate] owners = " << numOwners << ", arity = " << arity
+             << ", depth = " << r.depth << ", relays = " << r.relays << endl;
+        r.ok = runAllParties(topo, &r.ms);
+        rows.push_back(r);
+    }
+
+    cout << endl << "owners = " << numOwners << ", transport = "
+         << (base.transport == Transport::InProc ? "inproc" : "tcp") << endl;
+    cout << std::setw(8) << "arity" << std::setw(8) << "depth" << std::setw(8) << "relays"
+         << std::setw(14) << "latency ms" << endl;
+    bool ok = true;
+    for (auto& r : rows) {
+        cout << std::setw(8) << r.arity << std::setw(8) << r.depth << std::setw(8) << r.relays
+             << std::setw(14) << std::fixed << std::setprecision(1) << r.ms << std::defaultfloat
+             << (r.ok ? "" : "  FAILED") << endl;
+        ok &= r.ok;
+    }
+    return ok;
+}
+
+bool benchStreams(const Topology& base, uint64_t megabytes, const std::vector<uint64_t>& streamCounts)
+{
+    uint64_t rows = std::max<uint64_t>(1, (megabytes << 20) / sizeof(block));
+    oc::Matrix<block> D;
+    D.resize(rows, 1, oc::AllocType::Uninitialized);
+    for (uint64_t i = 0; i < rows; ++i)
+        D(i, 0) = block(i, ~i);
+
+    struct Row { uint64_t streams; double ms, cpuMs; bool ok; };
+    string mode;
+    vector<Row> results;
+
+    for (size_t run = 0; run < streamCounts.size(); ++run) {
+        // 两个参与方：1 发送，2 在本机 basePort + run 上接收
+        Topology topo = base;
+        topo.streams = streamCounts[run];
+        topo.parties.assign(2, PartyConfig());
+        auto& snd = topo.parties[0];
+        auto& rcv = topo.parties[1];
+        snd.id = 1;
+        snd.parent = 2;
+        rcv.id = 2;
+        rcv.role = PartyRole::Aggregator;
+        rcv.host = "127.0.0.1";
+        rcv.port = static_cast<uint16_t>(base.basePort + run);
+        rcv.fanIn = 1;
+
+        NodeListener listener;
+        if (!listener.open(topo, rcv, int(topo.streams)))
+            return false;
+
+        oc::Matrix<block> R;
+        auto start = std::chrono::steady_clock::now();
+        auto received = std::async(std::launch::async, [&] {
+            IoLoop loop;
+            return loop.init(topo.io) && recvMatrices(loop, listener, 1, [&](size_t, oc::Matrix<block>& M) {
+                R = std::move(M);
+                return true;
+            });
+        });
+
+        auto socks = connectStreams(topo, rcv.id);
+        IoLoop loop;
+        bool ok = !socks.empty() && initLoop(loop, topo, "[netbench]");
+        double cpuMs = 0;
+        if (ok) {
+            MatrixStreamSender sender;
+            sender.useZeroCopy(topo.zeroCopy);
+            sender.start(loop, socks, snd.id, D);
+            sender.submit(0, rows);
+            sender.close();
+            ok = sender.finish();
+            cpuMs = sender.cpuMs();
+            mode = sender.modeString();
+        }
+        ok = received.get() && ok;
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        closeSockets(socks);
+
+        ok = ok && R.rows() == rows && std::memcmp(R.data(), D.data(), rows * sizeof(block)) == 0;
+        results.push_back({ topo.streams, ms, cpuMs, ok });
+    }
+
+    double GB = rows * sizeof(block) / 1e9;
+    cout << endl << "payload = " << megabytes << " MiB, transport = "
+         << (base.transport == Transport::InProc ? "inproc" : "tcp loopback") << ", last run: " << mode << endl;
+    cout << std::setw(8) << "streams" << std::setw(12) << "ms" << std::setw(10) << "GB/s"
+         << std::setw(16) << "sender CPU ms" << endl;
+    bool ok = true;
+    for (auto& r : results) {
+        cout << std::setw(8) << r.streams << std::setw(12) << std::fixed << std::setprecision(1) << r.ms
+             << std::setw(10) << std::setprecision(2) << GB / (r.ms / 1000.0)
+             << std::setw(16) << std::setprecision(1) << r.cpuMs << std::defaultfloat
+             << (r.ok ? "" : "  FAILED") << endl;
+        ok &= r.ok;
+    }
+    return ok;
+}
+
+bool benchRounds(const Topology& topo, uint64_t rounds)
+{
+    using Clock = std::chrono::steady_clock;
+    auto ms = [](Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+
+    // 1. 冷启动：每次都载入 keys、预处理、建立连接
+    double coldMs = 0;
+    cout << "[rounds] cold run" << endl;
+    if (!runAllParties(topo, &coldMs))
+        return false;
+
+    // 2. 常驻服务：各方在自己的线程中运行，本线程逐轮下发轮次号，
+    //    等汇总方解完这一轮再下发下一轮
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t issued = 0, finished = 0;
+    size_t waiting = 0;
+    bool stop = false;
+    std::atomic<bool> failed(false);
+    auto numOwners = std::count_if(topo.parties.begin(), topo.parties.end(), [](const PartyConfig& p) {
+        return p.role == PartyRole::Owner;
+    });
+
+    auto setupStart = Clock::now();
+    vector<std::thread> thrds;
+    for (auto& p : topo.parties) {
+        auto mine = std::make_shared<uint64_t>(0);
+        RoundControl ctl;
+        ctl.next = [&, mine](uint64_t& round) {
+            std::unique_lock<std::mutex> lock(mtx);
+            ++waiting;
+            cv.notify_all();
+            cv.wait(lock, [&] { return stop || issued > *mine; });
+            --waiting;
+            if (stop)
+                return false;
+            round = *mine = issued;
+            return true;
+        };
+        ctl.done = [&](uint64_t round) {
+            std::lock_guard<std::mutex> lock(mtx);
+            finished = round;
+            cv.notify_all();
+        };
+        thrds.emplace_back([&, id = p.id, ctl] {
+            if (!serveParty(topo, id, ctl)) {
+                std::lock_guard<std::mutex> lock(mtx);
+                failed = true;
+                cv.notify_all();
+            }
+        });
+    }
+
+    double setupMs = 0;
+    vector<double> latency;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [&] { return waiting == size_t(numOwners) || failed; });
+        setupMs = ms(Clock::now() - setupStart);
+
+        for (uint64_t r = 1; r <= rounds && !failed; ++r) {
+            auto start = Clock::now();
+            issued = r;
+            cv.notify_all();
+            cv.wait(lock, [&] { return finished == r || failed; });
+            if (finished == r)
+                latency.push_back(ms(Clock::now() - start));
+        }
+        stop = true;
+        cv.notify_all();
+    }
+    for (auto& th : thrds)
+        th.join();
+
+    cout << endl << "parties = " << topo.parties.size() << ", transport = " << (topo.transport == Transport::InProc ? "inproc" : "tcp") << endl;
+    cout << std::fixed << std::setprecision(1);
+    cout << "cold run (load + prepare + encode + send + decode): " << coldMs << " ms" << endl;
+    cout << "service setup (load + prepare keys + connect):      " << setupMs << " ms" << endl;
+    cout << std::setw(8) << "round" << std::setw(12) << "ms" << endl;
+    double sum = 0;
+    for (size_t i = 0; i < latency.size(); ++i) {
+        cout << std::setw(8) << (i + 1) << std::setw(12) << latency[i] << endl;
+        if (i)
+            sum += latency[i];
+    }
+    // 第一轮还包含中间节点与汇总方 accept 连接的时间，不计入均值
+    if (latency.size() > 1)
+        cout << "warm round mean (rounds 2.." << latency.size() << "): " << sum / (latency.size() - 1) << " ms" << endl;
+    cout << std::defaultfloat;
+
+    if (failed || latency.size() != rounds) {
+        cout << "FAILED after " << latency.size() << " of " << rounds << " round(s)" << endl;
+        return false;
+    }
+    return true;
+}
+
+bool benchMemory(const Topology& base, uint64_t megabytes, const std::vector<uint64_t>& partyCounts)
+{
+    uint64_t rows = std::max<uint64_t>(1, (megabytes << 20) / sizeof(block));
+    oc::Matrix<block> D;
+    D.resize(rows, 1, oc::AllocType::Uninitialized);
+    for (uint64_t i = 0; i < rows; ++i)
+        D(i, 0) = block(i, ~i);
+    double MiB = rows * sizeof(block) / double(1 << 20);
+
+    struct Row { uint64_t parties; bool bounded; double ms, peakMiB; bool ok; };
+    vector<Row> results;
+
+    uint16_t port = base.basePort;
+    for (auto numSenders : partyCounts) {
+        for (bool bounded : { false, true }) {
+            // numSenders 个发送方共用同一个 D，汇总方在本机 port 上接收并异或
+            Topology topo = base;
+            topo.bounded = bounded;
+            topo.parties.assign(numSenders + 1, PartyConfig());
+            for (uint64_t i = 0; i < numSenders; ++i) {
+                topo.parties[i].id = i + 1;
+                topo.parties[i].parent = numSenders + 1;
+            }
+            auto& rcv = topo.parties.back();
+            rcv.id = numSenders + 1;
+            rcv.role = PartyRole::Aggregator;
+            rcv.host = "127.0.0.1";
+            rcv.port = port++;
+            rcv.fanIn = numSenders;
+
+            // 只统计汇总方接收期间新增的内存：D 与监听 socket 计入基线
+            Links links;
+            if (!links.open(topo, rcv))
+                return false;
+            double baseline = resetPeakRss();
+
+            cout << "[membench] " << numSenders << " sender(s), " << (bounded ? "bounded" : "full tables") << endl;
+            auto start = std::chrono::steady_clock::now();
+            oc::Matrix<block> acc;
+            auto received = std::async(std::launch::async, [&] {
+                uint64_t round;
+                bool closed;
+                return receiveXor(topo, rcv, links, acc, round, closed);
+            });
+
+            std::atomic<bool> sent(true);
+            vector<std::thread> senders;
+            for (uint64_t i = 0; i < numSenders; ++i)
+                senders.emplace_back([&, id = i + 1] {
+                    auto socks = connectStreams(topo, rcv.id);
+                    IoLoop loop;
+                    bool ok = !socks.empty() && loop.init(topo.io);
+                    if (ok) {
+                        MatrixStreamSender sender;
+                        sender.useZeroCopy(topo.zeroCopy);
+                        sender.start(loop, socks, id, D);
+                        sender.submit(0, rows);
+                        sender.close();
+                        ok = sender.finish();
+                    }
+                    closeSockets(socks);
+                    if (!ok)
+                        sent = false;
+                });
+            for (auto& th : senders)
+                th.join();
+            bool ok = received.get() && sent;
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            double peak = peakRssMiB() - baseline;
+
+            // 偶数个相同的 D 异或为 0，奇数个为 D 本身
+            if (ok && acc.rows() == rows) {
+                if (numSenders % 2)
+                    ok = std::memcmp(acc.data(), D.data(), rows * sizeof(block)) == 0;
+                else
+                    ok = std::all_of(acc.data(), acc.data() + acc.size(), [](const block& b) { return b == oc::ZeroBlock; });
+            } else {
+                ok = false;
+            }
+            results.push_back({ numSenders, bounded, ms, peak, ok });
+        }
+    }
+
+    cout << endl << "D = " << megabytes << " MiB, streams = " << base.streams << ", transport = "
+         << (base.transport == Transport::InProc ? "inproc" : "tcp loopback") << endl;
+    cout << std::setw(8) << "senders" << std::setw(10) << "mode" << std::setw(12) << "ms"
+         << std::setw(18) << "receiver RSS MiB" << std::setw(10) << "x D" << endl;
+    bool ok = true;
+    for (auto& r : results) {
+        cout << std::setw(8) << r.parties << std::setw(10) << (r.bounded ? "bounded" : "full")
+             << std::setw(12) << std::fixed << std::setprecision(1) << r.ms
+             << std::setw(18) << r.peakMiB << std::setw(10) << std::setprecision(2) << r.peakMiB / MiB
+             << std::defaultfloat << (r.ok ? "" : "  FAILED") << endl;
+        ok &= r.ok;
+    }
+    return ok;
+}
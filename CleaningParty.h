@@ -0,0 +1,49 @@
+// CleaningParty.h
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <functional>
+#include "Topology.h"
+
+// 运行拓扑中的一个参与方，直到其任务完成。
+bool runParty(const Topology& topo, uint64_t id);
+
+// 常驻服务的轮次控制。next 阻塞到下一轮开始，给出轮次号；返回 false 表示停止服务。
+// done 在汇总方解完一轮后以该轮的轮次号调用。数据拥有方只用 next，汇总方只用 done，
+// 中间节点与汇总方的轮次号取自子节点的连接头。
+struct RoundControl
+{
+    std::function<bool(uint64_t& round)> next;
+    std::function<void(uint64_t round)> done;
+};
+
+// 以常驻服务运行一个参与方：keys 只载入、预处理一次，连接在各轮之间保留，
+// 每轮只重新生成 values、编码、传输与解码。数据拥有方的 next 返回 false 后
+// 关闭连接，上游的中间节点与汇总方在子节点全部退出后依次结束。
+bool serveParty(const Topology& topo, uint64_t id, const RoundControl& ctl);
+
+// 在当前进程中为每个参与方启动一个线程运行整个拓扑，用于本机基准测试。
+// 传输方式为 tcp 时各方通过 loopback 通信（addr 应指向本机），inproc 时通过 socketpair。
+// 结束后打印端到端耗时，elapsedMs 非空时同时返回。
+bool runAllParties(const Topology& topo, double* elapsedMs = nullptr);
+
+// 本机模拟：对每个 arity 用 base 的全局参数生成 numOwners 个数据拥有方的
+// k 叉汇总树（Topology::buildTree），用 runAllParties 跑一遍，最后打印
+// 端到端延迟与树的元数、深度、中间节点个数的对照表。
+bool simulateTrees(const Topology& base, uint64_t numOwners, const std::vector<uint64_t>& arities);
+
+// 条带化传输基准：在本机 basePort 上用 streams 条连接传输 megabytes MiB 的 D
+// （base 的 transport 为 tcp 时走 loopback，zeroCopy 决定发送方式），校验内容并打印
+// GB/s、发送方 CPU 时间与连接数的对照表。
+bool benchStreams(const Topology& base, uint64_t megabytes, const std::vector<uint64_t>& streamCounts);
+
+// 汇总方内存基准：对每个发送方个数，让这么多个发送方（共用同一个 megabytes MiB
+// 的 D）同时发给一个汇总方，分别在保留各方 D 与 bounded（边收边异或）两种方式下
+// 接收，打印耗时与汇总方接收期间的 RSS 峰值增量（VmHWM）。
+bool benchMemory(const Topology& base, uint64_t megabytes, const std::vector<uint64_t>& partyCounts);
+
+// 多轮基准：先用 runAllParties 跑一次冷启动，再让所有参与方以常驻服务运行
+// rounds 轮，打印冷启动耗时、服务准备耗时（载入并预处理 keys、建立连接）
+// 与每轮的端到端延迟。
+bool benchRounds(const Topology& topo, uint64_t rounds);
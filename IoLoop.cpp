@@ -0,0 +1,951 @@
+// IoLoop.cpp
+#include "IoLoop.h"
+
+#include <iostream>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <sys/sendfile.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <poll.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <linux/errqueue.h>
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+
+// SEND_ZC 的用量报告是 6.2 的接口，头文件比它旧时只编译 epoll 后端
+#if defined(IORING_SEND_ZC_REPORT_USAGE) && defined(__NR_io_uring_setup)
+#define IOLOOP_HAVE_URING 1
+#endif
+
+using namespace std;
+
+namespace
+{
+    // 单次系统调用的最大长度，保证结果装得下 int
+    constexpr size_t MaxOpBytes = size_t(1) << 30;
+
+    // 固定缓冲区表的槽位数；io_uring 单个固定缓冲区最大 1 GiB
+    constexpr unsigned NumSlots = 64;
+    constexpr size_t MaxSlotBytes = size_t(1) << 30;
+
+    // 取出错误队列中已到达的零拷贝完成通知。socket 出错时返回 false
+    bool reapErrQueue(int fd, uint64_t& done, uint64_t& copied)
+    {
+        while (true) {
+            char control[256];
+            msghdr msg{};
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+
+            if (::recvmsg(fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0) {
+                if (errno == EINTR)
+                    continue;
+                return errno == EAGAIN || errno == EWOULDBLOCK;
+            }
+
+            for (auto cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm)) {
+                bool recvErr = (cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR) ||
+                               (cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR);
+                if (!recvErr)
+                    continue;
+                auto ee = reinterpret_cast<const sock_extended_err*>(CMSG_DATA(cm));
+                if (ee->ee_errno != 0 || ee->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+                    continue;
+                uint64_t n = uint64_t(ee->ee_data - ee->ee_info) + 1;
+                done += n;
+                if (ee->ee_code & SO_EE_CODE_ZEROCOPY_COPIED)
+                    copied += n;
+            }
+        }
+    }
+}
+
+const char* ioBackendName(IoBackend b)
+{
+    switch (b) {
+    case IoBackend::Uring: return "io_uring";
+    case IoBackend::Epoll: return "epoll";
+    default:               return "auto";
+    }
+}
+
+// 一个进行中的操作。recvAll/sendAll/sendFileAll 各对应一个 Op，
+// 每次系统调用只完成一部分时推进 done 并重新提交，直到完成或出错。
+struct IoLoop::Op
+{
+    OpKind kind;
+    int fd = -1;
+    char* buf = nullptr;
+    size_t len = 0;
+    size_t done = 0;
+    int file = -1;              // SendFile
+    uint64_t offset = 0;
+    uint32_t events = 0;        // Poll
+    Op* target = nullptr;       // Cancel
+    Callback cb;
+    int res = 0;
+    bool pollFirst = false;     // io_uring：先等 fd 就绪（EAGAIN 之后、sendfile）
+    bool completed = false;
+    bool finished = false;      // 回调已调用或被放弃
+    bool dropped = false;       // 已 cancel，不再调用回调
+    unsigned notifs = 0;        // io_uring SEND_ZC：尚未到达的通知
+};
+
+IoLoop::Op* IoLoop::newOp(OpKind kind, int fd, Callback cb)
+{
+    auto op = new Op;
+    op->kind = kind;
+    op->fd = fd;
+    op->cb = std::move(cb);
+    return op;
+}
+
+void IoLoop::recvAll(int fd, void* buf, size_t len, Callback cb)
+{
+    auto op = newOp(OpKind::Recv, fd, std::move(cb));
+    op->buf = static_cast<char*>(buf);
+    op->len = len;
+    submit(op);
+}
+
+void IoLoop::sendAll(int fd, const void* buf, size_t len, Callback cb, bool zeroCopy)
+{
+    bool zc = zeroCopy && !mNoZeroCopy.count(fd);
+    auto op = newOp(zc ? OpKind::SendZc : OpKind::Send, fd, std::move(cb));
+    op->buf = const_cast<char*>(static_cast<const char*>(buf));
+    op->len = len;
+    submit(op);
+}
+
+void IoLoop::sendFileAll(int fd, int file, uint64_t offset, size_t len, Callback cb)
+{
+    auto op = newOp(OpKind::SendFile, fd, std::move(cb));
+    op->file = file;
+    op->offset = offset;
+    op->len = len;
+    submit(op);
+}
+
+void IoLoop::pollIn(int fd, Callback cb)
+{
+    auto op = newOp(OpKind::Poll, fd, std::move(cb));
+    op->events = POLLIN;
+    submit(op);
+}
+
+void IoLoop::complete(Op* op, int res)
+{
+    op->res = res;
+    op->completed = true;
+    if (op->dropped)
+        finishOp(op);
+    else
+        mCompleted.push_back(op);
+}
+
+// 回调已调用（或被放弃）。零拷贝的通知全部到达之后才释放
+void IoLoop::finishOp(Op* op)
+{
+    op->finished = true;
+    if (op->notifs)
+        return;
+    mLive.erase(op);
+    delete op;
+}
+
+void IoLoop::dispatch()
+{
+    while (!mCompleted.empty()) {
+        vector<Op*> batch;
+        batch.swap(mCompleted);
+        for (auto op : batch) {
+            // 前面的回调可能 cancel 了它
+            if (!op->dropped && op->cb)
+                op->cb(op->res);
+            finishOp(op);
+        }
+    }
+}
+
+void IoLoop::post(std::function<void()> fn)
+{
+    {
+        std::lock_guard<std::mutex> lock(mPostMtx);
+        mPosted.push_back(std::move(fn));
+    }
+    uint64_t one = 1;
+    (void)!::write(mWakeFd, &one, sizeof(one));
+}
+
+void IoLoop::runPosted()
+{
+    vector<std::function<void()>> fns;
+    {
+        std::lock_guard<std::mutex> lock(mPostMtx);
+        fns.swap(mPosted);
+    }
+    for (auto& fn : fns)
+        fn();
+}
+
+void IoLoop::zeroCopyReaped(uint64_t n, uint64_t copied)
+{
+    mZeroCopyPending -= std::min(mZeroCopyPending, n);
+    mZeroCopyCopied += copied;
+}
+
+void IoLoop::run(const std::function<bool()>& done)
+{
+    while (true) {
+        runPosted();
+        dispatch();
+        if (done())
+            return;
+
+        // 回调里可能又有 post，此时不能阻塞
+        bool block;
+        {
+            std::lock_guard<std::mutex> lock(mPostMtx);
+            block = mPosted.empty();
+        }
+        if (mBackend == IoBackend::Uring) {
+            uringFlush(block);
+            uringReap();
+        } else {
+            epollWait(block);
+        }
+    }
+}
+
+std::string IoLoop::statsString() const
+{
+    std::string s = ioBackendName(mBackend);
+    s += ", " + std::to_string(mOps) + " ops in " + std::to_string(mSyscalls) +
+         (mBackend == IoBackend::Uring ? " io_uring_enter" : " epoll_wait");
+    if (mFixedOps)
+        s += ", " + std::to_string(mFixedOps) + " on registered buffers";
+    return s;
+}
+
+// ====================== io_uring 后端 ======================
+
+#ifdef IOLOOP_HAVE_URING
+
+struct IoLoop::Uring
+{
+    int fd = -1;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned* sqArray = nullptr;
+    unsigned sqMask = 0;
+    unsigned sqEntries = 0;
+    io_uring_sqe* sqes = nullptr;
+
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned cqMask = 0;
+    io_uring_cqe* cqes = nullptr;
+
+    void* sqRing = MAP_FAILED;
+    size_t sqRingLen = 0;
+    void* cqRing = MAP_FAILED;
+    size_t cqRingLen = 0;
+    size_t sqesLen = 0;
+
+    unsigned toSubmit = 0;
+
+    ~Uring()
+    {
+        if (sqes)
+            ::munmap(sqes, sqesLen);
+        if (cqRing != MAP_FAILED && cqRing != sqRing)
+            ::munmap(cqRing, cqRingLen);
+        if (sqRing != MAP_FAILED)
+            ::munmap(sqRing, sqRingLen);
+        if (fd >= 0)
+            ::close(fd);
+    }
+
+    // 取一个空闲的 SQE；提交队列满时返回 nullptr
+    io_uring_sqe* get()
+    {
+        unsigned tail = *sqTail;
+        if (tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) == sqEntries)
+            return nullptr;
+        auto sqe = &sqes[tail & sqMask];
+        std::memset(sqe, 0, sizeof(*sqe));
+        return sqe;
+    }
+
+    // 填好的 SQE 对内核可见，等下一次 io_uring_enter 一起提交
+    void push()
+    {
+        unsigned tail = *sqTail;
+        sqArray[tail & sqMask] = tail & sqMask;
+        __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+        ++toSubmit;
+    }
+};
+
+bool IoLoop::initUring(unsigned depth)
+{
+    auto ring = std::make_unique<Uring>();
+
+    io_uring_params p{};
+    p.flags = IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN;
+    ring->fd = int(::syscall(__NR_io_uring_setup, depth, &p));
+    if (ring->fd < 0 && errno == EINVAL) {
+        p = io_uring_params{};
+        ring->fd = int(::syscall(__NR_io_uring_setup, depth, &p));
+    }
+    if (ring->fd < 0)
+        return false;
+
+    ring->sqRingLen = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    ring->cqRingLen = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+    bool single = p.features & IORING_FEAT_SINGLE_MMAP;
+    if (single)
+        ring->sqRingLen = ring->cqRingLen = std::max(ring->sqRingLen, ring->cqRingLen);
+
+    ring->sqRing = ::mmap(nullptr, ring->sqRingLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sqRing == MAP_FAILED)
+        return false;
+    ring->cqRing = single ? ring->sqRing
+                          : ::mmap(nullptr, ring->cqRingLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                   ring->fd, IORING_OFF_CQ_RING);
+    if (ring->cqRing == MAP_FAILED)
+        return false;
+    ring->sqesLen = p.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = ::mmap(nullptr, ring->sqesLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring->fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+        return false;
+    ring->sqes = static_cast<io_uring_sqe*>(sqes);
+
+    auto sq = static_cast<char*>(ring->sqRing);
+    ring->sqHead = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+    ring->sqTail = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+    ring->sqArray = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+    ring->sqMask = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+    ring->sqEntries = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_entries);
+
+    auto cq = static_cast<char*>(ring->cqRing);
+    ring->cqHead = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+    ring->cqTail = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+    ring->cqMask = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+    ring->cqes = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+
+    // 稀疏的固定缓冲区表，之后按槽位更新；不支持时不使用固定缓冲区
+    io_uring_rsrc_register reg{};
+    reg.nr = NumSlots;
+    reg.flags = IORING_RSRC_REGISTER_SPARSE;
+    if (::syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS2, &reg, sizeof(reg)) >= 0)
+        mSlotUsed.assign(NumSlots, false);
+
+    mRing = std::move(ring);
+    return true;
+}
+
+void IoLoop::uringFlush(bool wait)
+{
+    auto& r = *mRing;
+    if (r.toSubmit == 0 && !wait)
+        return;
+
+    unsigned flags = wait ? IORING_ENTER_GETEVENTS : 0;
+    int n = int(::syscall(__NR_io_uring_enter, r.fd, r.toSubmit, wait ? 1 : 0, flags, nullptr, 0));
+    ++mSyscalls;
+    if (n >= 0) {
+        r.toSubmit -= std::min<unsigned>(r.toSubmit, unsigned(n));
+    } else if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+        // EBUSY/EAGAIN：完成队列满，先收割完成事件再提交
+        perror("io_uring_enter");
+    }
+}
+
+// 把 op 的下一步写入提交队列
+void IoLoop::uringPrep(Op* op)
+{
+    auto& r = *mRing;
+    io_uring_sqe* sqe;
+    while (!(sqe = r.get())) {
+        uringFlush(false);
+        uringReap();
+    }
+    sqe->user_data = reinterpret_cast<uint64_t>(op);
+    sqe->fd = op->fd;
+
+    char* p = op->buf + op->done;
+    size_t n = std::min(op->len - op->done, MaxOpBytes);
+
+    if (op->kind == OpKind::Cancel) {
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = reinterpret_cast<uint64_t>(op->target);
+    } else if (op->pollFirst || op->kind == OpKind::Poll || op->kind == OpKind::Wake) {
+        sqe->opcode = IORING_OP_POLL_ADD;
+        uint32_t ev = op->events;
+        if (op->pollFirst)
+            ev = op->kind == OpKind::Recv ? POLLIN : POLLOUT;
+        sqe->poll32_events = ev;
+    } else if (op->kind == OpKind::Recv) {
+        // 落在登记的缓冲区中时用 READ_FIXED（长度截断到槽位末尾）
+        int slot = -1;
+        if (mFixedRecv && !mRegions.empty()) {
+            auto it = mRegions.upper_bound(p);
+            if (it != mRegions.begin()) {
+                --it;
+                for (auto& rg : it->second)
+                    if (p >= rg.begin && p < rg.begin + rg.len) {
+                        slot = int(rg.slot);
+                        n = std::min<size_t>(n, rg.begin + rg.len - p);
+                    }
+            }
+        }
+        if (slot >= 0) {
+            sqe->opcode = IORING_OP_READ_FIXED;
+            sqe->buf_index = uint16_t(slot);
+            sqe->off = uint64_t(-1);
+            ++mFixedOps;
+        } else {
+            sqe->opcode = IORING_OP_RECV;
+        }
+        sqe->addr = reinterpret_cast<uint64_t>(p);
+        sqe->len = uint32_t(n);
+    } else {
+        sqe->opcode = op->kind == OpKind::SendZc ? IORING_OP_SEND_ZC : IORING_OP_SEND;
+        sqe->addr = reinterpret_cast<uint64_t>(p);
+        sqe->len = uint32_t(n);
+        sqe->msg_flags = MSG_NOSIGNAL;
+        if (op->kind == OpKind::SendZc && mZcReportUsage)
+            sqe->ioprio = IORING_SEND_ZC_REPORT_USAGE;
+    }
+    r.push();
+}
+
+// sendfile 没有对应的 io_uring 操作：socket 可写时在循环线程中直接调用，
+// 直到 EAGAIN 再等下一次可写
+void IoLoop::uringSendFile(Op* op)
+{
+    while (op->done < op->len) {
+        off_t off = off_t(op->offset + op->done);
+        ssize_t n = ::sendfile(op->fd, op->file, &off, std::min(op->len - op->done, MaxOpBytes));
+        if (n > 0) {
+            op->done += size_t(n);
+            continue;
+        }
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            op->pollFirst = true;
+            uringPrep(op);
+            return;
+        }
+        return complete(op, n < 0 ? -errno : -EPIPE);
+    }
+    complete(op, int(op->len));
+}
+
+void IoLoop::uringReap()
+{
+    auto& r = *mRing;
+    while (true) {
+        unsigned head = *r.cqHead;
+        if (head == __atomic_load_n(r.cqTail, __ATOMIC_ACQUIRE))
+            return;
+        auto& cqe = r.cqes[head & r.cqMask];
+        auto op = reinterpret_cast<Op*>(cqe.user_data);
+        int res = cqe.res;
+        uint32_t flags = cqe.flags;
+        __atomic_store_n(r.cqHead, head + 1, __ATOMIC_RELEASE);
+        uringCqe(op, res, flags);
+    }
+}
+
+void IoLoop::uringCqe(Op* op, int res, uint32_t flags)
+{
+    if (op->kind == OpKind::Cancel) {
+        mLive.erase(op);
+        delete op;
+        return;
+    }
+
+    // SEND_ZC 的第二个 CQE：内核不再引用这次发送的用户页
+    if (flags & IORING_CQE_F_NOTIF) {
+        --op->notifs;
+        zeroCopyReaped(1, mZcReportUsage && (res & IORING_NOTIF_USAGE_ZC_COPIED) ? 1 : 0);
+        if (op->finished)
+            finishOp(op);
+        return;
+    }
+    if (op->kind == OpKind::SendZc && (flags & IORING_CQE_F_MORE)) {
+        ++op->notifs;
+        ++mZeroCopyPending;
+        ++mZeroCopySends;
+    }
+    if (op->dropped)
+        return complete(op, -ECANCELED);
+
+    if (op->kind == OpKind::Wake) {
+        uint64_t v;
+        (void)!::read(mWakeFd, &v, sizeof(v));
+        uringPrep(op);
+        return;
+    }
+    if (op->kind == OpKind::Poll)
+        return complete(op, res);
+
+    if (op->pollFirst) {
+        op->pollFirst = false;
+        if (res < 0)
+            return complete(op, res);
+        if (op->kind == OpKind::SendFile)
+            return uringSendFile(op);
+        return uringPrep(op);
+    }
+
+    if (res == -EAGAIN || res == -EINTR) {
+        op->pollFirst = res == -EAGAIN;
+        return uringPrep(op);
+    }
+    if (op->kind == OpKind::Recv && res == -EINVAL && mFixedRecv && !mRegions.empty()) {
+        // 内核不支持 socket 上的 READ_FIXED
+        mFixedRecv = false;
+        return uringPrep(op);
+    }
+    if (op->kind == OpKind::SendZc && res == -EINVAL && mZcReportUsage) {
+        mZcReportUsage = false;     // 6.2 之前的内核没有用量报告
+        return uringPrep(op);
+    }
+    if (op->kind == OpKind::SendZc && (res == -EOPNOTSUPP || res == -EINVAL)) {
+        // 例如 inproc 的 AF_UNIX socket：退回拷贝
+        mNoZeroCopy.insert(op->fd);
+        ++mZeroCopyFallbacks;
+        op->kind = OpKind::Send;
+        return uringPrep(op);
+    }
+    if (op->kind == OpKind::SendZc && res == -ENOBUFS) {
+        op->kind = OpKind::Send;    // optmem 用尽：剩下的部分拷贝发送
+        return uringPrep(op);
+    }
+
+    if (res < 0)
+        return complete(op, res);
+    if (res == 0 && op->kind == OpKind::Recv)
+        return complete(op, int(op->done));     // 对端关闭
+    op->done += size_t(res);
+    if (op->done == op->len)
+        return complete(op, int(op->len));
+    uringPrep(op);
+}
+
+#else
+
+struct IoLoop::Uring {};
+
+bool IoLoop::initUring(unsigned) { return false; }
+void IoLoop::uringFlush(bool) {}
+void IoLoop::uringPrep(Op*) {}
+void IoLoop::uringSendFile(Op*) {}
+void IoLoop::uringReap() {}
+void IoLoop::uringCqe(Op*, int, uint32_t) {}
+
+#endif
+
+// ====================== epoll 后端 ======================
+
+struct IoLoop::EpollState
+{
+    struct Fd
+    {
+        std::deque<Op*> in, out;    // 按提交顺序，队首的操作等待就绪
+        uint32_t interest = 0;
+        bool added = false;
+        bool zcTried = false;
+        uint64_t zcIssued = 0;      // MSG_ZEROCOPY 发送次数
+        uint64_t zcDone = 0;        // 已收到完成通知的次数
+    };
+
+    int ep = -1;
+    std::map<int, Fd> fds;
+    std::set<int> dirty;            // 有新操作、还没直接尝试过的 fd
+
+    ~EpollState()
+    {
+        if (ep >= 0)
+            ::close(ep);
+    }
+};
+
+bool IoLoop::initEpoll()
+{
+    auto st = std::make_unique<EpollState>();
+    st->ep = ::epoll_create1(EPOLL_CLOEXEC);
+    if (st->ep < 0) {
+        perror("epoll_create1");
+        return false;
+    }
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.fd = mWakeFd;
+    if (::epoll_ctl(st->ep, EPOLL_CTL_ADD, mWakeFd, &ev) != 0) {
+        perror("epoll_ctl");
+        return false;
+    }
+    mEpoll = std::move(st);
+    return true;
+}
+
+// 尝试一次 op 的系统调用，直到完成或 EAGAIN。完成时返回 true
+bool IoLoop::epollTryOp(Op* op, uint32_t events)
+{
+    if (op->kind == OpKind::Poll) {
+        if (!(events & (op->events | EPOLLERR | EPOLLHUP)))
+            return false;
+        complete(op, int(events));
+        return true;
+    }
+
+    auto& f = mEpoll->fds[op->fd];
+    while (op->done < op->len) {
+        char* p = op->buf + op->done;
+        size_t n = std::min(op->len - op->done, MaxOpBytes);
+        ssize_t r;
+
+        if (op->kind == OpKind::SendZc && !f.zcTried) {
+            f.zcTried = true;
+            int one = 1;
+            if (::setsockopt(op->fd, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) != 0) {
+                // 例如 inproc 的 AF_UNIX socket：退回拷贝
+                mNoZeroCopy.insert(op->fd);
+                ++mZeroCopyFallbacks;
+            }
+        }
+        if (op->kind == OpKind::SendZc && mNoZeroCopy.count(op->fd))
+            op->kind = OpKind::Send;
+
+        switch (op->kind) {
+        case OpKind::Recv:
+            r = ::recv(op->fd, p, n, MSG_DONTWAIT);
+            if (r == 0) {
+                complete(op, int(op->done));    // 对端关闭
+                return true;
+            }
+            break;
+        case OpKind::Send:
+            r = ::send(op->fd, p, n, MSG_DONTWAIT | MSG_NOSIGNAL);
+            break;
+        case OpKind::SendZc:
+            r = ::send(op->fd, p, n, MSG_ZEROCOPY | MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (r > 0) {
+                ++f.zcIssued;
+                ++mZeroCopyPending;
+                ++mZeroCopySends;
+            } else if (r < 0 && errno == ENOBUFS) {
+                // optmem 用尽：先取回已到达的通知；一个也没有就这一段退回拷贝
+                uint64_t before = f.zcDone, copied = 0;
+                reapErrQueue(op->fd, f.zcDone, copied);
+                zeroCopyReaped(f.zcDone - before, copied);
+                if (f.zcDone == before)
+                    r = ::send(op->fd, p, n, MSG_DONTWAIT | MSG_NOSIGNAL);
+                else
+                    continue;
+            }
+            break;
+        case OpKind::SendFile: {
+            off_t off = off_t(op->offset + op->done);
+            r = ::sendfile(op->fd, op->file, &off, n);
+            break;
+        }
+        default:
+            return false;
+        }
+
+        if (r > 0) {
+            op->done += size_t(r);
+            continue;
+        }
+        if (r < 0 && errno == EINTR)
+            continue;
+        if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return false;
+        complete(op, r < 0 ? -errno : -EPIPE);
+        return true;
+    }
+    complete(op, int(op->len));
+    return true;
+}
+
+void IoLoop::epollTry(int fd, uint32_t events)
+{
+    auto it = mEpoll->fds.find(fd);
+    if (it == mEpoll->fds.end())
+        return;
+    auto& f = it->second;
+
+    // 错误队列非空时报告 EPOLLERR
+    if ((events & EPOLLERR) && f.zcIssued > f.zcDone) {
+        uint64_t before = f.zcDone, copied = 0;
+        if (!reapErrQueue(fd, f.zcDone, copied))
+            f.zcDone = f.zcIssued;      // socket 已出错，不会再有通知
+        zeroCopyReaped(f.zcDone - before, copied);
+    }
+
+    while (!f.in.empty() && epollTryOp(f.in.front(), events))
+        f.in.pop_front();
+    while (!f.out.empty() && epollTryOp(f.out.front(), events))
+        f.out.pop_front();
+}
+
+// 按队列是否为空更新关注的事件。空闲的 fd 留在 epoll 中（关注 0 个事件），
+// 避免每个操作都 ADD/DEL；有零拷贝通知未到时也必须留在其中以收到 EPOLLERR
+void IoLoop::epollInterest(int fd)
+{
+    auto it = mEpoll->fds.find(fd);
+    if (it == mEpoll->fds.end())
+        return;
+    auto& f = it->second;
+
+    uint32_t want = (f.in.empty() ? 0u : uint32_t(EPOLLIN | EPOLLRDHUP)) | (f.out.empty() ? 0u : uint32_t(EPOLLOUT));
+    if (f.added ? want == f.interest : want == 0 && f.zcIssued == f.zcDone)
+        return;
+
+    epoll_event ev{};
+    ev.events = want;
+    ev.data.fd = fd;
+    // fd 可能已被调用方关闭后复用，ADD/MOD 失败时换另一个再试
+    int first = f.added ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    int second = f.added ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+    if (::epoll_ctl(mEpoll->ep, first, fd, &ev) != 0 && ::epoll_ctl(mEpoll->ep, second, fd, &ev) != 0) {
+        perror("epoll_ctl");
+        return;
+    }
+    f.added = true;
+    f.interest = want;
+}
+
+void IoLoop::epollWait(bool block)
+{
+    auto& st = *mEpoll;
+
+    // 新提交的操作先直接尝试一次：数据往往已经就绪，省去一次 epoll_wait
+    std::set<int> dirty;
+    dirty.swap(st.dirty);
+    for (int fd : dirty) {
+        epollTry(fd, 0);
+        epollInterest(fd);
+    }
+    if (!mCompleted.empty())
+        block = false;
+
+    epoll_event events[64];
+    int n = ::epoll_wait(st.ep, events, 64, block ? -1 : 0);
+    ++mSyscalls;
+    if (n < 0) {
+        if (errno != EINTR)
+            perror("epoll_wait");
+        return;
+    }
+
+    for (int i = 0; i < n; ++i) {
+        int fd = events[i].data.fd;
+        if (fd == mWakeFd) {
+            uint64_t v;
+            (void)!::read(mWakeFd, &v, sizeof(v));
+            continue;
+        }
+        epollTry(fd, events[i].events);
+
+        // 出错或挂断、又没有操作在等的 fd 会一直报告事件，移出 epoll
+        auto it = st.fds.find(fd);
+        if (it != st.fds.end() && (events[i].events & (EPOLLERR | EPOLLHUP)) &&
+            it->second.in.empty() && it->second.out.empty() && it->second.zcIssued == it->second.zcDone) {
+            ::epoll_ctl(st.ep, EPOLL_CTL_DEL, fd, nullptr);
+            st.fds.erase(it);
+            continue;
+        }
+        epollInterest(fd);
+    }
+}
+
+// ====================== 公共部分 ======================
+
+IoLoop::IoLoop() = default;
+
+IoLoop::~IoLoop()
+{
+    // 先关闭 io_uring，内核不再引用各操作之后再释放它们
+    mRing.reset();
+    mEpoll.reset();
+    for (auto op : mLive)
+        delete op;
+    if (mWakeFd >= 0)
+        ::close(mWakeFd);
+}
+
+bool IoLoop::init(IoBackend want, unsigned depth)
+{
+    mWakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (mWakeFd < 0) {
+        perror("eventfd");
+        return false;
+    }
+
+    if (want != IoBackend::Epoll) {
+        if (initUring(depth)) {
+            mBackend = IoBackend::Uring;
+            armWake();
+            return true;
+        }
+        if (want == IoBackend::Uring) {
+            perror("io_uring_setup");
+            return false;
+        }
+    }
+    mBackend = IoBackend::Epoll;
+    return initEpoll();
+}
+
+// io_uring 下用一个常驻的 poll 操作等待 post() 的唤醒；epoll 下 eventfd 直接在 epoll 中
+void IoLoop::armWake()
+{
+    auto op = newOp(OpKind::Wake, mWakeFd, nullptr);
+    op->events = POLLIN;
+    submit(op);
+}
+
+void IoLoop::submit(Op* op)
+{
+    mLive.insert(op);
+    if (op->kind != OpKind::Wake && op->kind != OpKind::Cancel)
+        ++mOps;
+
+    if (mBackend == IoBackend::Uring) {
+        if (op->kind == OpKind::SendFile)
+            uringSendFile(op);
+        else
+            uringPrep(op);
+        return;
+    }
+
+    auto& f = mEpoll->fds[op->fd];
+    if (op->kind == OpKind::Recv || op->kind == OpKind::Poll)
+        f.in.push_back(op);
+    else
+        f.out.push_back(op);
+    mEpoll->dirty.insert(op->fd);
+}
+
+void IoLoop::cancel(int fd)
+{
+    vector<Op*> inFlight;
+    for (auto op : mLive) {
+        if (op->fd != fd || op->dropped || op->kind == OpKind::Cancel)
+            continue;
+        op->dropped = true;
+        if (!op->completed)
+            inFlight.push_back(op);
+    }
+
+    if (mBackend == IoBackend::Uring) {
+        // 按 user_data 取消，并立即提交，调用方随后可以关闭 fd、释放缓冲区
+        for (auto op : inFlight) {
+            auto c = newOp(OpKind::Cancel, -1, nullptr);
+            c->target = op;
+            submit(c);
+        }
+        uringFlush(false);
+        return;
+    }
+
+    for (auto op : inFlight) {
+        op->completed = true;
+        finishOp(op);
+    }
+    auto it = mEpoll->fds.find(fd);
+    if (it != mEpoll->fds.end()) {
+        zeroCopyReaped(it->second.zcIssued - it->second.zcDone, 0);
+        if (it->second.added)
+            ::epoll_ctl(mEpoll->ep, EPOLL_CTL_DEL, fd, nullptr);
+        mEpoll->fds.erase(it);
+    }
+    mEpoll->dirty.erase(fd);
+}
+
+void IoLoop::close(int fd)
+{
+    cancel(fd);
+    mNoZeroCopy.erase(fd);
+    ::close(fd);
+}
+
+bool IoLoop::registerBuffer(void* data, size_t len)
+{
+#ifdef IOLOOP_HAVE_URING
+    if (mBackend != IoBackend::Uring || mSlotUsed.empty() || len == 0)
+        return false;
+
+    auto begin = static_cast<char*>(data);
+    vector<Region> pieces;
+    bool ok = true;
+    for (size_t off = 0; off < len && ok; off += MaxSlotBytes) {
+        auto slot = std::find(mSlotUsed.begin(), mSlotUsed.end(), false) - mSlotUsed.begin();
+        if (size_t(slot) == mSlotUsed.size()) {
+            ok = false;
+            break;
+        }
+        iovec iov{ begin + off, std::min(MaxSlotBytes, len - off) };
+        io_uring_rsrc_update2 up{};
+        up.offset = unsigned(slot);
+        up.data = reinterpret_cast<uint64_t>(&iov);
+        up.nr = 1;
+        ok = ::syscall(__NR_io_uring_register, mRing->fd, IORING_REGISTER_BUFFERS_UPDATE, &up, sizeof(up)) == 1;
+        if (ok) {
+            mSlotUsed[slot] = true;
+            pieces.push_back({ begin + off, iov.iov_len, unsigned(slot) });
+        }
+    }
+
+    mRegions[begin] = std::move(pieces);
+    if (!ok)
+        unregisterBuffer(data);
+    return ok;
+#else
+    (void)data;
+    (void)len;
+    return false;
+#endif
+}
+
+void IoLoop::unregisterBuffer(void* data)
+{
+#ifdef IOLOOP_HAVE_URING
+    auto it = mRegions.find(static_cast<char*>(data));
+    if (it == mRegions.end())
+        return;
+    for (auto& rg : it->second) {
+        iovec iov{ nullptr, 0 };
+        io_uring_rsrc_update2 up{};
+        up.offset = rg.slot;
+        up.data = reinterpret_cast<uint64_t>(&iov);
+        up.nr = 1;
+        ::syscall(__NR_io_uring_register, mRing->fd, IORING_REGISTER_BUFFERS_UPDATE, &up, sizeof(up));
+        mSlotUsed[rg.slot] = false;
+    }
+    mRegions.erase(it);
+#else
+    (void)data;
+#endif
+}
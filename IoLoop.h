@@ -0,0 +1,155 @@
+// IoLoop.h
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <functional>
+
+// IoLoop 的后端
+enum class IoBackend
+{
+    Auto,         // 优先 io_uring，内核不支持（或被 seccomp 禁用）时退回 epoll
+    Uring,        // io_uring：操作批量写入提交队列，每轮只调用一次 io_uring_enter
+    Epoll         // epoll + 非阻塞系统调用
+};
+
+const char* ioBackendName(IoBackend b);
+
+// 单线程的异步 I/O 事件循环，参与方之间所有的 socket 读写都经过它。
+// 各操作立即返回，完成时在 run() 所在的线程中调用回调，因此同一个循环上的
+// 接收、异或、发送互相重叠而不需要额外的线程，回调之间也不需要加锁。
+//
+// 回调的 res 与 io_uring 的 cqe->res 含义相同：>= 0 为结果（字节数等），
+// < 0 为 -errno。io_uring 后端直接使用 <linux/io_uring.h> 的系统调用接口，
+// 不依赖 liburing。
+//
+// 除 post() 外，所有成员函数只能在循环线程中（或 run() 之前）调用。
+class IoLoop
+{
+public:
+    using Callback = std::function<void(int res)>;
+
+    IoLoop();
+    ~IoLoop();
+
+    IoLoop(const IoLoop&) = delete;
+    IoLoop& operator=(const IoLoop&) = delete;
+
+    // depth 为 io_uring 提交队列的长度
+    bool init(IoBackend want = IoBackend::Auto, unsigned depth = 256);
+
+    IoBackend backend() const { return mBackend; }
+
+    // 登记一段之后反复接收写入的内存（例如接收中的 D）。io_uring 下钉住页面并
+    // 放入固定缓冲区表，落在其中的接收改用 READ_FIXED，省去每次操作的页面
+    // 查找与引用计数；epoll 下为空操作。失败（例如超出 RLIMIT_MEMLOCK）时返回
+    // false，不影响正确性。unregisterBuffer 时不能有写入该内存的操作在进行。
+    bool registerBuffer(void* data, size_t len);
+    void unregisterBuffer(void* data);
+
+    // 收满 len 字节后回调。res 为 len，对端提前关闭时为已收到的字节数，出错为 -errno
+    void recvAll(int fd, void* buf, size_t len, Callback cb);
+
+    // 发完 len 字节后回调，res 为 len 或 -errno。zeroCopy 时用 MSG_ZEROCOPY
+    // （io_uring 下为 SEND_ZC）：回调之后内核可能仍引用 buf，zeroCopyPending()
+    // 归零之前 buf 不能释放或修改。不支持零拷贝的 socket 自动退回拷贝。
+    void sendAll(int fd, const void* buf, size_t len, Callback cb, bool zeroCopy = false);
+
+    // 用 sendfile 把 file 的 [offset, offset + len) 发到 fd，fd 须为非阻塞
+    void sendFileAll(int fd, int file, uint64_t offset, size_t len, Callback cb);
+
+    // fd 可读（或出错、被挂断）时回调一次，res 为 poll 事件
+    void pollIn(int fd, Callback cb);
+
+    // 放弃 fd 上所有进行中的操作，它们的回调不会再被调用
+    void cancel(int fd);
+
+    // cancel(fd) 后关闭 fd
+    void close(int fd);
+
+    // 线程安全：在循环线程中执行 fn（例如编码线程通知新完成的行）
+    void post(std::function<void()> fn);
+
+    // 处理完成事件，直到 done() 为真。done 在每批完成事件处理完后检查。
+    void run(const std::function<bool()>& done);
+
+    // 内核尚未释放的零拷贝发送
+    uint64_t zeroCopyPending() const { return mZeroCopyPending; }
+
+    // 零拷贝发送总数、其中内核仍做了拷贝的个数（如 loopback），以及退回拷贝的 socket 数
+    uint64_t zeroCopySends() const { return mZeroCopySends; }
+    uint64_t zeroCopyCopied() const { return mZeroCopyCopied; }
+    uint64_t zeroCopyFallbacks() const { return mZeroCopyFallbacks; }
+
+    // 后端、操作数、系统调用数等统计，用于日志
+    std::string statsString() const;
+
+private:
+    struct Op;
+    struct Uring;
+    struct EpollState;
+
+    // 单次操作：一次系统调用，可能只完成一部分
+    enum class OpKind { Recv, Send, SendZc, SendFile, Poll, Wake, Cancel };
+
+    Op* newOp(OpKind kind, int fd, Callback cb);
+    void submit(Op* op);
+    void complete(Op* op, int res);
+    void finishOp(Op* op);
+    void dispatch();
+
+    // io_uring 后端
+    bool initUring(unsigned depth);
+    void uringPrep(Op* op);
+    void uringSendFile(Op* op);
+    void uringFlush(bool wait);
+    void uringReap();
+    void uringCqe(Op* op, int res, uint32_t flags);
+
+    // epoll 后端
+    bool initEpoll();
+    void epollTry(int fd, uint32_t events);
+    bool epollTryOp(Op* op, uint32_t events);
+    void epollInterest(int fd);
+    void epollWait(bool block);
+
+    void armWake();
+    void runPosted();
+    void zeroCopyReaped(uint64_t n, uint64_t copied);
+
+    IoBackend mBackend = IoBackend::Epoll;
+    std::unique_ptr<Uring> mRing;
+    std::unique_ptr<EpollState> mEpoll;
+    int mWakeFd = -1;
+
+    std::set<Op*> mLive;            // 已提交、尚未释放的操作
+    std::vector<Op*> mCompleted;    // 已完成、等待调用回调的操作
+
+    // 固定缓冲区：登记的内存按不超过 1 GiB 切成若干槽位
+    struct Region { char* begin; size_t len; unsigned slot; };
+    std::map<char*, std::vector<Region>> mRegions;
+    std::vector<bool> mSlotUsed;
+    bool mFixedRecv = true;         // 内核不支持 socket 上的 READ_FIXED 时关闭
+
+    std::set<int> mNoZeroCopy;      // 不支持零拷贝的 socket
+    bool mZcReportUsage = true;
+
+    std::mutex mPostMtx;
+    std::vector<std::function<void()>> mPosted;
+
+    uint64_t mZeroCopyPending = 0;
+    uint64_t mZeroCopySends = 0;
+    uint64_t mZeroCopyCopied = 0;
+    uint64_t mZeroCopyFallbacks = 0;
+
+    uint64_t mOps = 0;
+    uint64_t mFixedOps = 0;
+    uint64_t mSyscalls = 0;         // io_uring_enter / epoll_wait 的次数
+};
@@ -0,0 +1,365 @@
+// MatchFilter.cpp
+#include "MatchFilter.h"
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <array>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <charconv>
+#include <algorithm>
+#include <iomanip>
+
+#include <immintrin.h>
+
+using namespace std;
+
+namespace
+{
+    enum class MatchImpl { Scalar, Avx2, Avx512 };
+
+    MatchImpl detectMatchImpl()
+    {
+        if (__builtin_cpu_supports("avx512f"))
+            return MatchImpl::Avx512;
+        if (__builtin_cpu_supports("avx2"))
+            return MatchImpl::Avx2;
+        return MatchImpl::Scalar;
+    }
+
+    MatchImpl matchImpl()
+    {
+        static const MatchImpl impl = detectMatchImpl();
+        return impl;
+    }
+
+    // 每段扫描一批行，匹配的行号先写进定长缓冲区再追加到该段的结果。
+    // SIMD 实现每次存满一个向量，缓冲区末尾要留出 8 个空位
+    constexpr uint64_t BatchRows = 8192;
+    constexpr uint64_t BatchSlack = 8;
+
+    // 把 16 位中偶数位上的 8 个比特收拢到低 8 位
+    inline unsigned evenBits(unsigned m)
+    {
+        m &= 0x5555;
+        m = (m | (m >> 1)) & 0x3333;
+        m = (m | (m >> 2)) & 0x0f0f;
+        m = (m | (m >> 4)) & 0x00ff;
+        return m;
+    }
+
+    // ---------------- 标量 ----------------
+
+    // 无分支压缩：每行都写一次，匹配时才前进
+    size_t scanScalar(const block* v, uint64_t begin, uint64_t end, const block& target, uint64_t* out)
+    {
+        size_t k = 0;
+        for (auto i = begin; i < end; ++i) {
+            out[k] = i;
+            k += v[i] == target;
+        }
+        return k;
+    }
+
+    // 多列：一行的所有列都等于 target 才算匹配
+    size_t scanRows(const block* v, uint64_t cols, uint64_t begin, uint64_t end, const block& target, uint64_t* out)
+    {
+        size_t k = 0;
+        for (auto i = begin; i < end; ++i) {
+            auto row = v + i * cols;
+            bool eq = true;
+            for (uint64_t j = 0; j < cols; ++j)
+                eq &= row[j] == target;
+            out[k] = i;
+            k += eq;
+        }
+        return k;
+    }
+
+    // ---------------- AVX2：查表置换压缩 ----------------
+
+#define AVX2_FN __attribute__((target("avx2")))
+
+    // 4 位掩码 -> permutevar8x32 的下标，把选中的 u64 lane 依次移到前面
+    struct Compact4
+    {
+        alignas(32) uint32_t perm[16][8];
+
+        Compact4()
+        {
+            for (unsigned m = 0; m < 16; ++m) {
+                unsigned p = 0;
+                for (unsigned j = 0; j < 4; ++j) {
+                    if (m & (1u << j)) {
+                        perm[m][2 * p] = 2 * j;
+                        perm[m][2 * p + 1] = 2 * j + 1;
+                        ++p;
+                    }
+                }
+                for (; p < 4; ++p)
+                    perm[m][2 * p] = perm[m][2 * p + 1] = 0;
+            }
+        }
+    };
+
+    const Compact4 gCompact4;
+
+    AVX2_FN size_t scanAvx2(const block* v, uint64_t begin, uint64_t end, const block& target, uint64_t* out)
+    {
+        const __m256i t = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&target)));
+        const __m256i four = _mm256_set1_epi64x(4);
+        __m256i idx = _mm256_add_epi64(_mm256_set1_epi64x(begin), _mm256_setr_epi64x(0, 1, 2, 3));
+
+        size_t k = 0;
+        uint64_t i = begin;
+        for (; i + 4 <= end; i += 4) {
+            // 每个 block 占两个 u64 lane，两个 lane 都相等才匹配
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(v + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(v + i + 2));
+            unsigned ma = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, t)));
+            unsigned mb = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(b, t)));
+            unsigned both = ma | (mb << 4);
+            unsigned m = evenBits(both & (both >> 1));
+            if (m) {
+                auto perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(gCompact4.perm[m]));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), _mm256_permutevar8x32_epi32(idx, perm));
+                k += __builtin_popcount(m);
+            }
+            idx = _mm256_add_epi64(idx, four);
+        }
+        return k + scanScalar(v, i, end, target, out + k);
+    }
+
+#undef AVX2_FN
+
+    // ---------------- AVX-512：压缩存储 ----------------
+
+#define AVX512_FN __attribute__((target("avx512f")))
+
+    AVX512_FN size_t scanAvx512(const block* v, uint64_t begin, uint64_t end, const block& target, uint64_t* out)
+    {
+        const __m512i t = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&target)));
+        const __m512i eight = _mm512_set1_epi64(8);
+        __m512i idx = _mm512_add_epi64(_mm512_set1_epi64(begin), _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0));
+
+        size_t k = 0;
+        uint64_t i = begin;
+        for (; i + 8 <= end; i += 8) {
+            unsigned ka = _mm512_cmpeq_epi64_mask(_mm512_loadu_si512(v + i), t);
+            unsigned kb = _mm512_cmpeq_epi64_mask(_mm512_loadu_si512(v + i + 4), t);
+            unsigned both = ka | (kb << 8);
+            unsigned m = evenBits(both & (both >> 1));
+            if (m) {
+                _mm512_mask_compressstoreu_epi64(out + k, static_cast<__mmask8>(m), idx);
+                k += __builtin_popcount(m);
+            }
+            idx = _mm512_add_epi64(idx, eight);
+        }
+        return k + scanScalar(v, i, end, target, out + k);
+    }
+
+#undef AVX512_FN
+
+    using ScanFn = size_t (*)(const block*, uint64_t, uint64_t, const block&, uint64_t*);
+
+    ScanFn scanFnOf(MatchImpl impl)
+    {
+        switch (impl) {
+        case MatchImpl::Avx512: return scanAvx512;
+        case MatchImpl::Avx2:   return scanAvx2;
+        default:                return scanScalar;
+        }
+    }
+
+    // 并行执行 routine(t)，t = 0 .. numThreads-1，最后一段在当前线程中执行
+    template<typename Fn>
+    void parallelFor(size_t numThreads, Fn&& routine)
+    {
+        vector<std::thread> thrds(numThreads - 1);
+        for (size_t t = 0; t < thrds.size(); ++t)
+            thrds[t] = std::thread(routine, t);
+        routine(thrds.size());
+        for (auto& th : thrds)
+            th.join();
+    }
+
+    uint64_t matchRowsWith(oc::MatrixView<const block> vals, const block& target, vector<uint64_t>& idx,
+        size_t numThreads, MatchImpl impl)
+    {
+        uint64_t n = vals.rows(), cols = vals.cols();
+        if (numThreads == 0)
+            numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        // 每个线程至少 64K 行
+        numThreads = std::max<size_t>(1, std::min<size_t>(numThreads, n / 65536));
+
+        // 1. 各段独立扫描并压缩
+        vector<vector<uint64_t>> parts(numThreads);
+        auto scan = scanFnOf(impl);
+        parallelFor(numThreads, [&](size_t t) {
+            uint64_t begin = n * t / numThreads, end = n * (t + 1) / numThreads;
+            vector<uint64_t> buf(BatchRows + BatchSlack);
+            for (auto b = begin; b < end; b += BatchRows) {
+                auto e = std::min(b + BatchRows, end);
+                size_t k = cols == 1 ? scan(vals.data(), b, e, target, buf.data())
+                                     : scanRows(vals.data(), cols, b, e, target, buf.data());
+                parts[t].insert(parts[t].end(), buf.begin(), buf.begin() + k);
+            }
+        });
+
+        // 2. 按段的顺序拼接，行号保持升序
+        vector<uint64_t> offsets(numThreads + 1, 0);
+        for (size_t t = 0; t < numThreads; ++t)
+            offsets[t + 1] = offsets[t] + parts[t].size();
+        idx.resize(offsets.back());
+        parallelFor(numThreads, [&](size_t t) {
+            std::copy(parts[t].begin(), parts[t].end(), idx.begin() + offsets[t]);
+        });
+        return idx.size();
+    }
+
+    uint64_t keyValue(const block& key)
+    {
+        uint64_t v;
+        std::memcpy(&v, &key, sizeof(v));
+        return v;
+    }
+}
+
+uint64_t matchRows(
+    oc::MatrixView<const block> vals,
+    const block& target,
+    std::vector<uint64_t>& idx,
+    size_t numThreads)
+{
+    return matchRowsWith(vals, target, idx, numThreads, matchImpl());
+}
+
+bool writeMatches(
+    const std::string& path,
+    MatchFormat format,
+    const std::vector<uint64_t>& idx,
+    const std::vector<block>& keys,
+    const block& target)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        cerr << "writeMatches: cannot open " << path << endl;
+        return false;
+    }
+
+    if (format == MatchFormat::Binary) {
+        MatchFileHeader h{};
+        std::memcpy(h.magic, "CLNMATCH", 8);
+        h.version = 1;
+        h.numKeys = keys.size();
+        h.numMatches = idx.size();
+        h.target = target;
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        out.write(reinterpret_cast<const char*>(idx.data()), idx.size() * sizeof(uint64_t));
+    } else {
+        // 先格式化到缓冲区，攒满 1 MiB 写一次
+        vector<char> buf(1 << 20);
+        size_t used = 0;
+        auto flush = [&] {
+            out.write(buf.data(), used);
+            used = 0;
+        };
+        const char head[] = "index,key\n";
+        out.write(head, sizeof(head) - 1);
+        for (auto i : idx) {
+            if (i >= keys.size()) {
+                cerr << "writeMatches: row " << i << " is out of range for " << keys.size() << " keys" << endl;
+                return false;
+            }
+            if (buf.size() - used < 48)
+                flush();
+            auto p = buf.data() + used, e = buf.data() + buf.size();
+            p = std::to_chars(p, e, i).ptr;
+            *p++ = ',';
+            p = std::to_chars(p, e, keyValue(keys[i])).ptr;
+            *p++ = '\n';
+            used = p - buf.data();
+        }
+        flush();
+    }
+
+    if (!out.good()) {
+        cerr << "writeMatches: failed to write " << path << endl;
+        return false;
+    }
+    return true;
+}
+
+const char* matchBackend()
+{
+    switch (matchImpl()) {
+    case MatchImpl::Avx512: return "avx512";
+    case MatchImpl::Avx2:   return "avx2";
+    default:                return "scalar";
+    }
+}
+
+void benchMatch(size_t n, size_t rate, size_t numThreads)
+{
+    if (numThreads == 0)
+        numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+    // splitmix64 生成的随机值，约每 rate 行放一个 target
+    oc::Matrix<block> vals;
+    vals.resize(n, 1, oc::AllocType::Uninitialized);
+    block target = oc::ZeroBlock;
+    uint64_t s = 0x9e3779b97f4a7c15ull;
+    auto next = [&] {
+        uint64_t z = (s += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    };
+    for (size_t i = 0; i < n; ++i) {
+        auto r = next();
+        vals(i, 0) = rate && r % rate == 0 ? target : block(next(), r);
+    }
+
+    double GB = n * sizeof(block) / 1e9;
+    auto time = [&](const char* name, auto&& fn) {
+        auto start = chrono::steady_clock::now();
+        fn();
+        double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "  " << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(2)
+             << GB / sec << " GB/s (" << std::setprecision(1) << sec * 1000 << " ms)" << std::defaultfloat << endl;
+    };
+
+    cout << "match filter, n = " << n << ", 1/" << rate << " rows match, threads = " << numThreads
+         << ", backend = " << matchBackend() << endl;
+
+    // 参照：同样线程数下把 vals 拷贝一遍（目标已预先触页）
+    {
+        oc::Matrix<block> dst;
+        dst.resize(n, 1, oc::AllocType::Zeroed);
+        time("memcpy (reference)", [&] {
+            parallelFor(numThreads, [&](size_t t) {
+                size_t begin = n * t / numThreads, end = n * (t + 1) / numThreads;
+                std::memcpy(dst.data() + begin, vals.data() + begin, (end - begin) * sizeof(block));
+            });
+        });
+    }
+
+    vector<uint64_t> ref, idx;
+    time("scalar", [&] { matchRowsWith(vals, target, ref, numThreads, MatchImpl::Scalar); });
+    cout << "  " << ref.size() << " matches" << endl;
+
+    auto check = [&](const char* name) {
+        if (idx != ref)
+            cout << "  " << name << " does not match the scalar result!" << endl;
+    };
+    if (__builtin_cpu_supports("avx2")) {
+        time("avx2", [&] { matchRowsWith(vals, target, idx, numThreads, MatchImpl::Avx2); });
+        check("avx2");
+    }
+    if (__builtin_cpu_supports("avx512f")) {
+        time("avx512", [&] { matchRowsWith(vals, target, idx, numThreads, MatchImpl::Avx512); });
+        check("avx512");
+    }
+}
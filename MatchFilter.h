@@ -0,0 +1,50 @@
+// MatchFilter.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <cryptoTools/Common/Defines.h>
+#include <cryptoTools/Common/Matrix.h>
+
+using osuCrypto::block;
+
+// 清洗结果的输出格式
+enum class MatchFormat
+{
+    Binary,     // MatchFileHeader 之后是 numMatches 个小端 u64 行号
+    Csv         // 每行 "行号,key"，key 为 keys.csv 中的十进制数
+};
+
+struct MatchFileHeader
+{
+    char     magic[8];      // "CLNMATCH"
+    uint64_t version;
+    uint64_t numKeys;       // 被扫描的行数
+    uint64_t numMatches;
+    block    target;
+};
+
+// 找出 vals 中所有列都等于 target 的行，行号按升序写入 idx。
+// vals 被切成 numThreads 段并行扫描，每段用 AVX-512（压缩存储）、AVX2（查表
+// 置换压缩）或标量实现，运行时选择；各段的结果最后拼接。numThreads = 0
+// 表示使用所有核。返回匹配的行数。
+uint64_t matchRows(
+    oc::MatrixView<const block> vals,
+    const block& target,
+    std::vector<uint64_t>& idx,
+    size_t numThreads = 0);
+
+// 把 matchRows 的结果写到 path。Csv 格式需要 keys（与 vals 的行一一对应）。
+bool writeMatches(
+    const std::string& path,
+    MatchFormat format,
+    const std::vector<uint64_t>& idx,
+    const std::vector<block>& keys,
+    const block& target);
+
+// 当前机器上 matchRows 使用的实现："avx512"、"avx2" 或 "scalar"
+const char* matchBackend();
+
+// 基准：n 行、约 1/rate 行匹配时各实现的 GB/s，与同样大小的 memcpy 对比，并校验结果一致
+void benchMatch(size_t n, size_t rate, size_t numThreads);
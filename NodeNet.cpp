@@ -0,0 +1,847 @@
+// NodeNet.cpp
+#include "NodeNet.h"
+
+#include <iostream>
+#include <map>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <iterator>
+#include <cerrno>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <time.h>
+
+using namespace std;
+
+// ====================== 条带化发送 ======================
+
+namespace
+{
+    bool setNonBlocking(int fd)
+    {
+        int flags = ::fcntl(fd, F_GETFL, 0);
+        return flags >= 0 && ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+    }
+
+    double threadCpuMs()
+    {
+        timespec ts;
+        ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+    }
+}
+
+MatrixStreamSender::~MatrixStreamSender()
+{
+    // 未 finish 就放弃时，回调不能再引用本对象
+    if (mLoop && !mFinished)
+        for (auto& st : mStreams)
+            mLoop->cancel(st.sock);
+}
+
+void MatrixStreamSender::startStreams(IoLoop& loop, const std::vector<int>& socks, uint64_t senderId)
+{
+    mLoop = &loop;
+    mSender = senderId;
+    mStreams.assign(socks.size(), Stream());
+    for (size_t i = 0; i < socks.size(); ++i) {
+        mStreams[i].sock = socks[i];
+        setNonBlocking(socks[i]);
+    }
+    mZeroCopySends = loop.zeroCopySends();
+    mZeroCopyCopied = loop.zeroCopyCopied();
+    mZeroCopyFallbacks = loop.zeroCopyFallbacks();
+    mStart = chrono::steady_clock::now();
+}
+
+void MatrixStreamSender::start(IoLoop& loop, const std::vector<int>& socks, uint64_t senderId, const oc::Matrix<block>& M)
+{
+    mM = &M;
+    startStreams(loop, socks, senderId);
+}
+
+void MatrixStreamSender::start(IoLoop& loop, const std::vector<int>& socks, uint64_t senderId, oc::MatrixView<const block> D)
+{
+    mView = D;
+    startStreams(loop, socks, senderId);
+}
+
+oc::MatrixView<const block> MatrixStreamSender::view() const
+{
+    if (mM)
+        return oc::MatrixView<const block>(mM->data(), mM->rows(), mM->cols());
+    return mView;
+}
+
+// 调用方持有 mMtx。多次提交合并成一次唤醒
+void MatrixStreamSender::wake()
+{
+    if (mWakePosted || !mLoop)
+        return;
+    mWakePosted = true;
+    mLoop->post([this] { pump(); });
+}
+
+void MatrixStreamSender::submit(uint64_t rowBegin, uint64_t rowEnd)
+{
+    if (rowBegin >= rowEnd)
+        return;
+
+    std::lock_guard<std::mutex> lock(mMtx);
+    mPending[rowBegin] = rowEnd;
+
+    // 把能接上前缀的区间依次并入
+    auto old = mFrontier;
+    for (auto it = mPending.find(mFrontier); it != mPending.end(); it = mPending.find(mFrontier)) {
+        mFrontier = it->second;
+        mPending.erase(it);
+    }
+    if (mFrontier != old)
+        wake();
+}
+
+void MatrixStreamSender::close()
+{
+    std::lock_guard<std::mutex> lock(mMtx);
+    mClosed = true;
+    wake();
+}
+
+// 给空闲的连接分配工作：先发连接头，之后按行号顺序认领已完成的数据块
+void MatrixStreamSender::pump()
+{
+    uint64_t frontier;
+    bool closed;
+    {
+        std::lock_guard<std::mutex> lock(mMtx);
+        frontier = mFrontier;
+        closed = mClosed;
+        mWakePosted = false;
+    }
+
+    // 有行提交时 M 已经分配好最终形状
+    if (!mD.data() && frontier > 0) {
+        mD = view();
+        mRowBytes = mD.cols() * sizeof(block);
+        mChunkRows = std::max<uint64_t>(1, StripeChunkBytes / mRowBytes);
+    }
+    if (frontier == 0 && closed)
+        mFailed = true;     // 一行都没有提交（例如编码失败）
+
+    uint64_t rows = mD.rows();
+    for (size_t s = 0; s < mStreams.size() && !mFailed && frontier > 0; ++s) {
+        auto& st = mStreams[s];
+        if (st.busy)
+            continue;
+
+        if (!st.helloSent) {
+            uint64_t hello[6] = { htobe64(mSender), htobe64(s), htobe64(mStreams.size()),
+                                  htobe64(mRound), htobe64(rows), htobe64(mD.cols()) };
+            std::copy(hello, hello + 6, st.hello);
+            st.busy = true;
+            mLoop->sendAll(st.sock, st.hello, sizeof(st.hello), [this, s](int res) {
+                mStreams[s].helloSent = res >= 0;
+                if (res >= 0 && mFirstSendMs < 0)
+                    mFirstSendMs = chrono::duration<double, milli>(chrono::steady_clock::now() - mStart).count();
+                streamDone(s, res);
+            });
+            continue;
+        }
+
+        if (mNextRow == rows) {
+            // 没有数据块可认领了，发结束标记
+            if (!st.ended) {
+                st.busy = true;
+                st.hdr[0] = htobe64(rows);
+                st.hdr[1] = 0;
+                mLoop->sendAll(st.sock, st.hdr, sizeof(st.hdr), [this, s](int res) {
+                    mStreams[s].ended = res >= 0;
+                    streamDone(s, res);
+                });
+            }
+            continue;
+        }
+        uint64_t begin = mNextRow, end = std::min(begin + mChunkRows, rows);
+        if (frontier < end) {
+            if (closed)
+                mFailed = true;     // 有行未提交
+            continue;
+        }
+        mNextRow = end;
+        sendChunk(s, begin, end);
+    }
+
+    bool idle = std::none_of(mStreams.begin(), mStreams.end(), [](const Stream& st) { return st.busy; });
+    bool allSent = mD.data() && mNextRow == rows &&
+                   std::all_of(mStreams.begin(), mStreams.end(), [](const Stream& st) { return st.ended; });
+    if (idle && (mFailed || allSent))
+        mFinished = true;
+}
+
+void MatrixStreamSender::sendChunk(size_t s, uint64_t begin, uint64_t end)
+{
+    auto& st = mStreams[s];
+    st.busy = true;
+    st.hdr[0] = htobe64(begin);
+    st.hdr[1] = htobe64(end - begin);
+
+    mLoop->sendAll(st.sock, st.hdr, sizeof(st.hdr), [this, s, begin, end](int res) {
+        if (res < 0)
+            return streamDone(s, res);
+        auto sock = mStreams[s].sock;
+        auto len = (end - begin) * mRowBytes;
+        auto cb = [this, s](int r) { streamDone(s, r); };
+        if (mFileFd >= 0)
+            mLoop->sendFileAll(sock, mFileFd, mFileOffset + begin * mRowBytes, len, cb);
+        else
+            mLoop->sendAll(sock, reinterpret_cast<const char*>(mD.data()) + begin * mRowBytes, len, cb, mZeroCopy);
+    });
+}
+
+void MatrixStreamSender::streamDone(size_t s, int res)
+{
+    mStreams[s].busy = false;
+    if (res < 0)
+        mFailed = true;
+    pump();
+}
+
+bool MatrixStreamSender::done() const
+{
+    // D 在所有零拷贝发送被内核释放之前不能被释放
+    return mFinished && mLoop->zeroCopyPending() == 0;
+}
+
+bool MatrixStreamSender::finish()
+{
+    if (!mLoop)
+        return false;
+    double cpuStart = threadCpuMs();
+    mLoop->run([this] { return done(); });
+    mCpuMs = threadCpuMs() - cpuStart;
+
+    mZeroCopySends = mLoop->zeroCopySends() - mZeroCopySends;
+    mZeroCopyCopied = mLoop->zeroCopyCopied() - mZeroCopyCopied;
+    mZeroCopyFallbacks = mLoop->zeroCopyFallbacks() - mZeroCopyFallbacks;
+    return !mFailed;
+}
+
+std::string MatrixStreamSender::modeString() const
+{
+    std::string io = std::string(" (") + ioBackendName(mLoop ? mLoop->backend() : IoBackend::Auto) + ")";
+    if (mFileFd >= 0)
+        return "sendfile" + io;
+    if (!mZeroCopy || mZeroCopySends == 0)
+        return (mZeroCopy ? "copy, zerocopy unsupported on this socket" : "copy") + io;
+    auto s = "zerocopy, " + std::to_string(mZeroCopySends) + " sends, " +
+             std::to_string(mZeroCopyCopied) + " copied by kernel";
+    if (mZeroCopyFallbacks)
+        s += ", " + std::to_string(mZeroCopyFallbacks) + " stream(s) fell back to copy";
+    return s + io;
+}
+
+// ====================== 进程内传输 ======================
+
+namespace
+{
+    // 每个登记的汇总方一个信箱，里面是等待 accept 的连接。
+    // pending 非空时 eventFd 可读，供 epoll 等待。
+    struct Mailbox
+    {
+        std::deque<int> pending;
+        int eventFd = -1;
+    };
+
+    std::mutex gMtx;
+    std::condition_variable gCv;
+    std::map<uint64_t, Mailbox> gMailboxes;
+
+    // 取出一个待 accept 的连接，调用方持有 gMtx
+    int popPending(Mailbox& box)
+    {
+        int fd = box.pending.front();
+        box.pending.pop_front();
+        if (box.pending.empty()) {
+            uint64_t v;
+            (void)!::read(box.eventFd, &v, sizeof(v));   // 计数清零
+        }
+        return fd;
+    }
+
+    void printPeer(uint64_t id, const sockaddr_in& clientAddr)
+    {
+        char ip[INET_ADDRSTRLEN] = { 0 };
+        ::inet_ntop(AF_INET, &clientAddr.sin_addr, ip, sizeof(ip));
+        cout << "[p" << id << "] Accepted connection from " << ip << ":" << ntohs(clientAddr.sin_port) << endl;
+    }
+}
+
+NodeListener::~NodeListener()
+{
+    close();
+}
+
+bool NodeListener::open(const Topology& topo, const PartyConfig& self, int backlog)
+{
+    mTransport = topo.transport;
+    mId = self.id;
+
+    if (mTransport == Transport::InProc) {
+        std::lock_guard<std::mutex> lock(gMtx);
+        if (gMailboxes.count(mId)) {
+            cerr << "[p" << mId << "] in-process listener already registered" << endl;
+            return false;
+        }
+        mEventFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (mEventFd < 0) {
+            perror("eventfd");
+            return false;
+        }
+        gMailboxes[mId].eventFd = mEventFd;
+        mRegistered = true;
+        gCv.notify_all();
+        return true;
+    }
+
+    mSock = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (mSock < 0) {
+        perror("socket");
+        return false;
+    }
+
+    int opt = 1;
+    ::setsockopt(mSock, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(self.port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);   // 监听所有网卡，addr 中的 host 供其他参与方连接
+
+    if (::bind(mSock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        ::listen(mSock, backlog) < 0 || !setNonBlocking(mSock)) {
+        perror("bind/listen");
+        close();
+        return false;
+    }
+    return true;
+}
+
+int NodeListener::accept()
+{
+    if (mTransport == Transport::InProc) {
+        std::unique_lock<std::mutex> lock(gMtx);
+        auto& box = gMailboxes[mId];
+        gCv.wait(lock, [&] { return !box.pending.empty(); });
+        return popPending(box);
+    }
+
+    // 监听 socket 是非阻塞的，没有连接时先 poll 等待
+    while (true) {
+        sockaddr_in clientAddr{};
+        socklen_t clientLen = sizeof(clientAddr);
+        int fd = ::accept(mSock, reinterpret_cast<sockaddr*>(&clientAddr), &clientLen);
+        if (fd >= 0) {
+            printPeer(mId, clientAddr);
+            return fd;
+        }
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            perror("accept");
+            return -1;
+        }
+        pollfd pfd{ mSock, POLLIN, 0 };
+        ::poll(&pfd, 1, -1);
+    }
+}
+
+int NodeListener::tryAccept()
+{
+    if (mTransport == Transport::InProc) {
+        std::lock_guard<std::mutex> lock(gMtx);
+        auto& box = gMailboxes[mId];
+        if (box.pending.empty()) {
+            errno = EAGAIN;
+            return -1;
+        }
+        int fd = popPending(box);
+        if (!setNonBlocking(fd)) {
+            perror("fcntl");
+            ::close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    sockaddr_in clientAddr{};
+    socklen_t clientLen = sizeof(clientAddr);
+    int fd = ::accept4(mSock, reinterpret_cast<sockaddr*>(&clientAddr), &clientLen, SOCK_NONBLOCK);
+    if (fd < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            perror("accept");
+        return -1;
+    }
+    printPeer(mId, clientAddr);
+    return fd;
+}
+
+int NodeListener::pollFd() const
+{
+    return mTransport == Transport::InProc ? mEventFd : mSock;
+}
+
+void NodeListener::close()
+{
+    if (mSock >= 0)
+        ::close(mSock);
+    mSock = -1;
+
+    if (mRegistered) {
+        std::lock_guard<std::mutex> lock(gMtx);
+        for (int fd : gMailboxes[mId].pending)
+            ::close(fd);
+        gMailboxes.erase(mId);
+        ::close(mEventFd);
+        mEventFd = -1;
+        mRegistered = false;
+    }
+}
+
+int connectToParty(const Topology& topo, uint64_t peerId, int timeoutMs)
+{
+    auto peer = topo.find(peerId);
+    if (!peer) {
+        cerr << "connectToParty: unknown party " << peerId << endl;
+        return -1;
+    }
+
+    auto deadline = chrono::steady_clock::now() + chrono::milliseconds(timeoutMs);
+
+    if (topo.transport == Transport::InProc) {
+        std::unique_lock<std::mutex> lock(gMtx);
+        if (!gCv.wait_until(lock, deadline, [&] { return gMailboxes.count(peerId) != 0; })) {
+            cerr << "connectToParty: party " << peerId << " is not listening" << endl;
+            return -1;
+        }
+
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+            perror("socketpair");
+            return -1;
+        }
+        auto& box = gMailboxes[peerId];
+        box.pending.push_back(fds[1]);
+        uint64_t one = 1;
+        (void)!::write(box.eventFd, &one, sizeof(one));
+        gCv.notify_all();
+        return fds[0];
+    }
+
+    addrinfo hints{}, * res = nullptr;
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    if (::getaddrinfo(peer->host.c_str(), std::to_string(peer->port).c_str(), &hints, &res) != 0) {
+        cerr << "connectToParty: cannot resolve " << peer->host << endl;
+        return -1;
+    }
+
+    int sock = -1;
+    while (true) {
+        sock = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (sock < 0) {
+            perror("socket");
+            break;
+        }
+        if (::connect(sock, res->ai_addr, res->ai_addrlen) == 0)
+            break;
+
+        ::close(sock);
+        sock = -1;
+        if (chrono::steady_clock::now() >= deadline) {
+            cerr << "connectToParty: " << peer->host << ":" << peer->port << " did not accept within "
+                 << timeoutMs << " ms" << endl;
+            break;
+        }
+        std::this_thread::sleep_for(chrono::milliseconds(100));
+    }
+
+    ::freeaddrinfo(res);
+    return sock;
+}
+
+std::vector<int> connectStreams(const Topology& topo, uint64_t peerId, int timeoutMs)
+{
+    std::vector<int> socks;
+    for (uint64_t i = 0; i < std::max<uint64_t>(1, topo.streams); ++i) {
+        int sock = connectToParty(topo, peerId, timeoutMs);
+        if (sock < 0) {
+            closeSockets(socks);
+            break;
+        }
+        socks.push_back(sock);
+    }
+    return socks;
+}
+
+void closeSockets(std::vector<int>& socks)
+{
+    for (int fd : socks)
+        ::close(fd);
+    socks.clear();
+}
+
+// ====================== 并发接收 ======================
+
+MatrixReceiver::~MatrixReceiver()
+{
+    if (!mLoop)
+        return;
+    stopAccepting();
+    for (auto& c : mConns) {
+        if (c.stage)
+            mLoop->unregisterBuffer(c.stage.get());
+        if (c.fd < 0)
+            continue;
+        if (mKeep)
+            mLoop->cancel(c.fd);
+        else
+            mLoop->close(c.fd);
+    }
+    for (auto& t : mTransfers)
+        if (!t.done)
+            mLoop->unregisterBuffer(t.M.data());
+}
+
+void MatrixReceiver::start(IoLoop& loop, NodeListener& listener, size_t count, OnMatrix onMatrix, OnRows onRows)
+{
+    mLoop = &loop;
+    mListener = &listener;
+    mTag = "[p" + std::to_string(listener.id()) + "]";
+    mCount = count;
+    mOnMatrix = std::move(onMatrix);
+    mOnRows = std::move(onRows);
+    if (count == 0)
+        return;
+
+    mAccepting = true;
+    mLoop->pollIn(listener.pollFd(), [this](int) { acceptAll(); });
+}
+
+void MatrixReceiver::start(IoLoop& loop, const std::vector<int>& conns, uint64_t selfId, size_t count,
+                           OnMatrix onMatrix, OnRows onRows)
+{
+    mLoop = &loop;
+    mTag = "[p" + std::to_string(selfId) + "]";
+    mCount = count;
+    mKeep = true;
+    mOnMatrix = std::move(onMatrix);
+    mOnRows = std::move(onRows);
+
+    for (int fd : conns) {
+        mConns.emplace_back();
+        mConns.back().fd = fd;
+        readHello(mConns.size() - 1);
+    }
+}
+
+std::vector<int> MatrixReceiver::takeConns()
+{
+    std::vector<int> fds;
+    for (auto& c : mConns) {
+        if (c.fd >= 0)
+            fds.push_back(c.fd);
+        c.fd = -1;
+    }
+    return fds;
+}
+
+void MatrixReceiver::stopAccepting()
+{
+    if (mAccepting)
+        mLoop->cancel(mListener->pollFd());
+    mAccepting = false;
+}
+
+void MatrixReceiver::fail(const std::string& why)
+{
+    if (mFailed)
+        return;
+    cerr << mTag << " " << why << endl;
+    mFailed = true;
+    stopAccepting();
+    for (auto& c : mConns)
+        if (c.fd >= 0)
+            closeConn(c);
+}
+
+void MatrixReceiver::closeConn(Conn& c)
+{
+    if (mKeep)
+        mLoop->cancel(c.fd);
+    else
+        mLoop->close(c.fd);
+    if (!mKeep)
+        c.fd = -1;
+}
+
+// 这条连接上的本矩阵已经结束。保留的连接留给下一轮，不再读取
+void MatrixReceiver::streamEnded(Conn& c)
+{
+    ++mStreamsEnded;
+    if (!mKeep)
+        closeConn(c);
+    if (done())
+        stopAccepting();
+}
+
+void MatrixReceiver::acceptAll()
+{
+    mAccepting = false;
+    while (true) {
+        int fd = mListener->tryAccept();
+        if (fd < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                break;
+            return fail("accept failed");
+        }
+        mConns.emplace_back();
+        mConns.back().fd = fd;
+        readHello(mConns.size() - 1);
+    }
+    if (!done()) {
+        mAccepting = true;
+        mLoop->pollIn(mListener->pollFd(), [this](int) { acceptAll(); });
+    }
+}
+
+void MatrixReceiver::readHello(size_t ci)
+{
+    auto& c = mConns[ci];
+    mLoop->recvAll(c.fd, c.hello, sizeof(c.hello), [this, ci](int res) { onHello(ci, res); });
+}
+
+void MatrixReceiver::onHello(size_t ci, int res)
+{
+    auto& c = mConns[ci];
+    if (res == 0 && mKeep && mListener == nullptr) {
+        // 常驻服务的子节点在两轮之间关闭连接：全部关闭表示服务结束
+        if (!mTransfers.empty())
+            return fail("connection " + std::to_string(ci + 1) + " closed while the round was running");
+        if (++mHelloEofs == mConns.size())
+            mClosed = true;
+        return;
+    }
+    if (res != int(sizeof(c.hello)) || mHelloEofs)
+        return fail("connection " + std::to_string(ci + 1) + " failed or closed mid-transfer");
+
+    uint64_t sender = be64toh(c.hello[0]), stream = be64toh(c.hello[1]), numStreams = be64toh(c.hello[2]);
+    uint64_t round = be64toh(c.hello[3]), rows = be64toh(c.hello[4]), cols = be64toh(c.hello[5]);
+
+    if (!mRoundKnown) {
+        mRound = round;
+        mRoundKnown = true;
+    } else if (round != mRound) {
+        return fail("sender " + std::to_string(sender) + " is on round " + std::to_string(round) +
+                    ", expected round " + std::to_string(mRound));
+    }
+
+    Transfer* t = nullptr;
+    for (auto& x : mTransfers)
+        if (x.sender == sender)
+            t = &x;
+
+    if (!t) {
+        if (mTransfers.size() == mCount || numStreams == 0 || cols == 0)
+            return fail("unexpected stream from sender " + std::to_string(sender));
+        mTransfers.emplace_back();
+        t = &mTransfers.back();
+        t->sender = sender;
+        t->numStreams = numStreams;
+        t->rows = rows;
+        mStreamsTotal += numStreams;
+        t->rowBytes = cols * sizeof(block);
+        if (mFold) {
+            // 第一个发送方决定累加矩阵的形状，之后的发送方必须一致
+            if (mTransfers.size() > 1 && (mFold->rows() != rows || mFold->cols() != cols))
+                return fail("sender " + std::to_string(sender) + " sends " + std::to_string(rows) + "x" +
+                            std::to_string(cols) + ", expected " + std::to_string(mFold->rows()) + "x" +
+                            std::to_string(mFold->cols()) + " (all parties must use the same PaxosParam)");
+            if (mTransfers.size() == 1) {
+                if (mFold->rows() != rows || mFold->cols() != cols)
+                    mFold->resize(rows, cols, oc::AllocType::Zeroed);
+                else
+                    std::memset(mFold->data(), 0, mFold->size() * sizeof(block));
+            }
+        } else {
+            auto reuse = mPool ? std::find_if(mPool->begin(), mPool->end(), [&](const oc::Matrix<block>& M) {
+                return M.rows() == rows && M.cols() == cols;
+            }) : std::vector<oc::Matrix<block>>::iterator();
+            if (mPool && reuse != mPool->end()) {
+                t->M = std::move(*reuse);
+                mPool->erase(reuse);
+            } else {
+                t->M.resize(rows, cols, oc::AllocType::Uninitialized);
+            }
+            mLoop->registerBuffer(t->M.data(), t->M.size() * sizeof(block));
+        }
+    } else if (t->done) {
+        // 没有认领到数据块的连接，其连接头可能在矩阵收完后才到
+    } else if (t->numStreams != numStreams || t->rows != rows || t->rowBytes != cols * sizeof(block)) {
+        return fail("stream " + std::to_string(stream) + " of sender " + std::to_string(sender) +
+                    " disagrees on shape");
+    }
+    if (stream >= numStreams || ++t->streamsSeen > numStreams)
+        return fail("bad stream index " + std::to_string(stream) + " from sender " + std::to_string(sender));
+
+    c.t = t;
+    readChunk(ci);
+}
+
+void MatrixReceiver::readChunk(size_t ci)
+{
+    auto& c = mConns[ci];
+    mLoop->recvAll(c.fd, c.chunk, sizeof(c.chunk), [this, ci](int res) { onChunkHeader(ci, res); });
+}
+
+// [begin, end) 是否与已收到的行或已认领的块重叠。重叠的块会让同一行被写两次
+// （foldInto 时被异或两次），而 rowsGot 仍可能凑满 rows
+bool MatrixReceiver::overlapsClaimed(const Transfer& t, uint64_t begin, uint64_t end)
+{
+    if (begin < t.frontier)
+        return true;
+    auto next = t.claimed.lower_bound(begin);
+    if (next != t.claimed.end() && next->first < end)
+        return true;
+    return next != t.claimed.begin() && std::prev(next)->second > begin;
+}
+
+void MatrixReceiver::onChunkHeader(size_t ci, int res)
+{
+    auto& c = mConns[ci];
+    auto& t = *c.t;
+    if (res == 0)
+        return fail("sender " + std::to_string(t.sender) + " closed a stream after " +
+                    std::to_string(t.rowsGot) + " of " + std::to_string(t.rows) + " rows");
+    if (res != int(sizeof(c.chunk)))
+        return fail("connection " + std::to_string(ci + 1) + " failed or closed mid-transfer");
+
+    uint64_t begin = be64toh(c.chunk[0]), cnt = be64toh(c.chunk[1]);
+    if (cnt == 0 && begin == t.rows)
+        return streamEnded(c);
+    if (cnt == 0 || t.done || begin > t.rows || cnt > t.rows - begin || overlapsClaimed(t, begin, begin + cnt))
+        return fail("bad chunk [" + std::to_string(begin) + ", +" + std::to_string(cnt) + ") on connection " +
+                    std::to_string(ci + 1));
+    t.claimed[begin] = begin + cnt;
+    c.chunk[0] = begin;
+    c.chunk[1] = cnt;
+    if (mFold) {
+        c.folded = 0;
+        return readStage(ci);
+    }
+    auto dst = reinterpret_cast<char*>(t.M.data()) + begin * t.rowBytes;
+    mLoop->recvAll(c.fd, dst, cnt * t.rowBytes, [this, ci](int res) { onChunkData(ci, res); });
+}
+
+void MatrixReceiver::onChunkData(size_t ci, int res)
+{
+    auto& c = mConns[ci];
+    auto& t = *c.t;
+    if (res != int(c.chunk[1] * t.rowBytes))
+        return fail("connection " + std::to_string(ci + 1) + " failed or closed mid-transfer");
+    chunkDone(ci);
+}
+
+// foldInto：把当前数据块的下一段整行读进这条连接的暂存区
+void MatrixReceiver::readStage(size_t ci)
+{
+    auto& c = mConns[ci];
+    auto& t = *c.t;
+    auto stageRows = std::max<uint64_t>(1, FoldStageBytes / t.rowBytes);
+    if (c.stageBytes < stageRows * t.rowBytes) {
+        if (c.stage)
+            mLoop->unregisterBuffer(c.stage.get());
+        c.stageBytes = stageRows * t.rowBytes;
+        c.stage.reset(new block[c.stageBytes / sizeof(block)]);
+        mLoop->registerBuffer(c.stage.get(), c.stageBytes);
+    }
+    auto n = std::min(stageRows, c.chunk[1] - c.folded);
+    mLoop->recvAll(c.fd, c.stage.get(), n * t.rowBytes, [this, ci](int res) { onStage(ci, res); });
+}
+
+void MatrixReceiver::onStage(size_t ci, int res)
+{
+    auto& c = mConns[ci];
+    auto& t = *c.t;
+    auto n = std::min(std::max<uint64_t>(1, FoldStageBytes / t.rowBytes), c.chunk[1] - c.folded);
+    if (res != int(n * t.rowBytes))
+        return fail("connection " + std::to_string(ci + 1) + " failed or closed mid-transfer");
+
+    auto len = n * t.rowBytes / sizeof(block);
+    auto dst = mFold->data() + (c.chunk[0] + c.folded) * (t.rowBytes / sizeof(block));
+    auto src = c.stage.get();
+    for (uint64_t j = 0; j < len; ++j)
+        dst[j] = dst[j] ^ src[j];
+    c.folded += n;
+    if (c.folded < c.chunk[1])
+        return readStage(ci);
+    chunkDone(ci);
+}
+
+void MatrixReceiver::chunkDone(size_t ci)
+{
+    auto& c = mConns[ci];
+    auto& t = *c.t;
+
+    // 一个数据块收完，并入前缀
+    t.pending[c.chunk[0]] = c.chunk[0] + c.chunk[1];
+    auto old = t.frontier;
+    for (auto it = t.pending.find(t.frontier); it != t.pending.end(); it = t.pending.find(t.frontier)) {
+        t.frontier = it->second;
+        t.pending.erase(it);
+    }
+    // 前缀内的块不用再单独记着，begin < frontier 已经覆盖
+    while (!t.claimed.empty() && t.claimed.begin()->second <= t.frontier)
+        t.claimed.erase(t.claimed.begin());
+    t.rowsGot += c.chunk[1];
+
+    if (mOnRows && t.frontier > old) {
+        size_t ti = 0;
+        while (&mTransfers[ti] != &t)
+            ++ti;
+        if (!mOnRows(ti, mFold ? *mFold : t.M, t.frontier))
+            return fail("receive aborted");
+    }
+
+    if (t.rowsGot < t.rows)
+        return readChunk(ci);
+
+    // 收完一个矩阵，立即交给调用方处理，不等其他发送方；各连接上只剩结束标记
+    t.done = true;
+    if (!mFold)
+        mLoop->unregisterBuffer(t.M.data());
+    if (!mOnMatrix(mCompleted++, t.M))
+        return fail("receive aborted");
+    t.M = oc::Matrix<block>();
+    readChunk(ci);
+}
+
+bool recvMatrices(IoLoop& loop, NodeListener& listener, size_t count,
+                  const MatrixReceiver::OnMatrix& onMatrix,
+                  const MatrixReceiver::OnRows& onRows)
+{
+    MatrixReceiver receiver;
+    receiver.start(loop, listener, count, onMatrix, onRows);
+    loop.run([&] { return receiver.done(); });
+    return receiver.ok();
+}
@@ -0,0 +1,320 @@
+// NodeNet.h
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <cryptoTools/Common/Defines.h>
+#include <cryptoTools/Common/Matrix.h>
+#include "Topology.h"
+#include "IoLoop.h"
+
+using osuCrypto::block;
+
+// 矩阵的线上格式。一个矩阵可以分在多条并行的连接（条带）上发送，每条连接先发
+//     [sender] [stream] [numStreams] [round] [rows] [cols]    6 个 u64 大端
+// 之后是若干数据块，每块为
+//     [rowBegin] [rowCount] [rowCount x cols 个 block]        头部 2 个 u64 大端
+// 最后以 [rows] [0] 结束这条连接上的本矩阵。数据块按行号依次被各条连接认领，
+// 接收方按 rowBegin 直接写入矩阵的对应位置。sender 区分不同的发送方，同一发送方
+// 的各条连接 numStreams、round、rows、cols 相同。有结束标记，常驻服务可以在同一组
+// 连接上逐轮发送下一个矩阵（下一个连接头），round 为轮次号，一次性运行时为 0。
+static constexpr uint64_t StripeChunkBytes = 4 << 20;
+
+// 内存有界的接收（MatrixReceiver::foldInto）中每条连接的暂存区大小。数据块
+// 按整行分段读入暂存区，每段读完立即异或进累加矩阵
+static constexpr uint64_t FoldStageBytes = 256 << 10;
+
+// 边编码边发送矩阵：各编码线程通过 submit 提交 M 中已确定的行区间，可以乱序。
+// 所有连接都由一个 IoLoop 驱动：某条连接空闲、下一个约 StripeChunkBytes 的
+// 数据块的行全部落在已完成的前缀中时，该连接认领并发出它。发送与后续行的
+// 编码重叠，多条连接并行发送，而不需要每条连接一个线程。
+//
+// 数据块默认用 send 拷贝进内核。start 之前可以选择：
+//   useZeroCopy  内存中的 D 用零拷贝发送（io_uring 的 SEND_ZC 或 MSG_ZEROCOPY），
+//                内核直接引用用户页。done() 要等所有完成通知都到达才为真，
+//                之前 D 不能释放或修改。不支持的 socket（如 inproc 的 AF_UNIX）
+//                退回拷贝。
+//   useFile      D 已在文件中（如 OkvsFile 的数据区），数据块用 sendfile 直接
+//                从页缓存发送，不经过用户态。
+class MatrixStreamSender
+{
+public:
+    MatrixStreamSender() = default;
+    ~MatrixStreamSender();
+
+    MatrixStreamSender(const MatrixStreamSender&) = delete;
+    MatrixStreamSender& operator=(const MatrixStreamSender&) = delete;
+
+    void useZeroCopy(bool on) { mZeroCopy = on; }
+
+    // 第 r 行位于 fd 的 offset + r * cols * sizeof(block) 处；fd 由调用方关闭
+    void useFile(int fd, uint64_t offset) { mFileFd = fd; mFileOffset = offset; }
+
+    // 连接头中的轮次号。第一次 submit 之前设置
+    void setRound(uint64_t round) { mRound = round; }
+
+    // 在 loop 上开始发送，socks 被设为非阻塞。M 在第一次 submit 之前分配好
+    // 最终形状，之后直到 done() 都不能重新分配；socks 由调用方在 done() 之后关闭，
+    // 或者留给下一轮的 sender 继续使用
+    void start(IoLoop& loop, const std::vector<int>& socks, uint64_t senderId, const oc::Matrix<block>& M);
+
+    // 同上，但 D 的形状已经确定（例如 mmap 的 OkvsFile）
+    void start(IoLoop& loop, const std::vector<int>& socks, uint64_t senderId, oc::MatrixView<const block> D);
+
+    // M 的 [rowBegin, rowEnd) 行已经是最终值，线程安全
+    void submit(uint64_t rowBegin, uint64_t rowEnd);
+
+    // 不再有新的提交，线程安全
+    void close();
+
+    // 循环线程中调用：各连接都已发完（或失败），零拷贝的页面也都已被内核释放
+    bool done() const;
+
+    // 在调用线程中运行 loop 直到 done()，close() 须已调用或将由编码线程调用。
+    // 有行未提交（例如编码失败）或发送失败时返回 false
+    bool finish();
+
+    // 开始发送（第一个连接头发出）的时刻，相对 start
+    double firstSendMs() const { return mFirstSendMs; }
+
+    // finish() 之后可用：finish() 期间循环线程的 CPU 时间，以及发送方式的说明
+    double cpuMs() const { return mCpuMs; }
+    std::string modeString() const;
+
+private:
+    struct Stream
+    {
+        int sock = -1;
+        bool helloSent = false;
+        bool ended = false;         // 结束标记已发出
+        bool busy = false;          // 有操作在进行
+        uint64_t hello[6];
+        uint64_t hdr[2];
+    };
+
+    void startStreams(IoLoop& loop, const std::vector<int>& socks, uint64_t senderId);
+    void wake();
+    void pump();
+    void sendChunk(size_t s, uint64_t begin, uint64_t end);
+    void streamDone(size_t s, int res);
+    oc::MatrixView<const block> view() const;
+
+    IoLoop* mLoop = nullptr;
+    std::vector<Stream> mStreams;
+    uint64_t mSender = 0;
+    uint64_t mRound = 0;
+    const oc::Matrix<block>* mM = nullptr;
+    oc::MatrixView<const block> mView;
+
+    bool mZeroCopy = false;
+    int mFileFd = -1;
+    uint64_t mFileOffset = 0;
+
+    // submit/close 可能来自编码线程
+    std::mutex mMtx;
+    std::map<uint64_t, uint64_t> mPending;  // 已完成但还接不上前缀的区间 begin -> end
+    uint64_t mFrontier = 0;                 // [0, mFrontier) 行已完成
+    bool mClosed = false;                   // close() 之后不再有提交
+    bool mWakePosted = false;
+
+    // 以下只在循环线程中访问
+    oc::MatrixView<const block> mD;         // 第一次有行完成时确定
+    uint64_t mRowBytes = 0;
+    uint64_t mChunkRows = 0;
+    uint64_t mNextRow = 0;                  // 下一个待认领数据块的起始行
+    bool mFailed = false;
+    bool mFinished = false;
+
+    std::chrono::steady_clock::time_point mStart;
+    double mFirstSendMs = -1;
+    double mCpuMs = 0;
+    uint64_t mZeroCopySends = 0;
+    uint64_t mZeroCopyCopied = 0;
+    uint64_t mZeroCopyFallbacks = 0;
+};
+
+// 汇总方的监听端。Tcp 下监听 party 的 addr；InProc 下在进程内登记 party id，
+// 等待同一进程中的其他参与方通过 connectToParty 连进来。
+class NodeListener
+{
+public:
+    NodeListener() = default;
+    ~NodeListener();
+
+    NodeListener(const NodeListener&) = delete;
+    NodeListener& operator=(const NodeListener&) = delete;
+
+    bool open(const Topology& topo, const PartyConfig& self, int backlog);
+
+    // 返回已连接的 socket，失败返回 -1
+    int accept();
+
+    // 非阻塞版本：没有待 accept 的连接时返回 -1 且 errno 为 EAGAIN。
+    // 返回的 socket 为非阻塞模式。
+    int tryAccept();
+
+    // 有待 accept 的连接时可读的 fd，供 epoll 使用。
+    // Tcp 下为监听 socket，InProc 下为信箱的 eventfd。
+    int pollFd() const;
+
+    uint64_t id() const { return mId; }
+
+    void close();
+
+private:
+    Transport mTransport = Transport::Tcp;
+    uint64_t mId = 0;
+    int mSock = -1;
+    int mEventFd = -1;
+    bool mRegistered = false;
+};
+
+// 在 IoLoop 上同时接收 count 个发送方的矩阵：连接到达即 accept，各连接的
+// 数据块交错读入所属矩阵（收到连接头后即按 rows x cols 分配，并登记为 loop 的
+// 固定缓冲区，数据块直接写到最终位置）。某个矩阵收完后立即在循环线程中调用
+// onMatrix(i, M)，i 为完成的先后次序，M 可以被移走。接收耗时取决于最慢的
+// 发送方，而不是各发送方耗时之和。onMatrix 返回 false 时中止接收。
+//
+// onRows 非空时，每当发送方 t（按第一个连接头到达的先后编号）从第 0 行起连续
+// 收到的行数增加，就以正在填充的 M 和该行数 rows 调用 onRows(t, M, rows)，
+// 一个矩阵的最后一次调用先于它的 onMatrix。M.data() 从第一次调用起不再变化，
+// 调用方可以在接收过程中读写前 rows 行（例如按 bin 流式解码，或异或后转发），
+// 并在 onMatrix 中把 M 移走以保留缓冲区。onRows 返回 false 时同样中止接收。
+//
+// 常驻服务在同一组连接上逐轮接收：第一轮 keepConns 后从 listener accept，
+// 结束时用 takeConns 取走连接；之后各轮用 start(loop, conns, ...) 在这些连接上
+// 等待下一个连接头。同一轮中各连接头的 round 必须一致。
+class MatrixReceiver
+{
+public:
+    using OnMatrix = std::function<bool(size_t, oc::Matrix<block>&)>;
+    using OnRows = std::function<bool(size_t, oc::Matrix<block>&, uint64_t)>;
+
+    MatrixReceiver() = default;
+    ~MatrixReceiver();
+
+    MatrixReceiver(const MatrixReceiver&) = delete;
+    MatrixReceiver& operator=(const MatrixReceiver&) = delete;
+
+    void start(IoLoop& loop, NodeListener& listener, size_t count,
+               OnMatrix onMatrix, OnRows onRows = nullptr);
+
+    // 在已经建立的连接上接收下一轮，连接保持打开，由调用方关闭。selfId 只用于日志
+    void start(IoLoop& loop, const std::vector<int>& conns, uint64_t selfId, size_t count,
+               OnMatrix onMatrix, OnRows onRows = nullptr);
+
+    // 在 start(listener) 之前调用：接收结束后不关闭 accept 到的连接
+    void keepConns() { mKeep = true; }
+
+    // 在 start 之前调用：新矩阵优先取 pool 中形状相同的缓冲区（上一轮的 D）
+    void reuseBuffers(std::vector<oc::Matrix<block>>& pool) { mPool = &pool; }
+
+    // 在 start 之前调用：不为每个发送方分配矩阵，收到的数据经每条连接一个
+    // FoldStageBytes 的暂存区直接异或进 acc，峰值内存约为一个 D 加上暂存区，
+    // 与发送方个数无关。acc 在第一个连接头到达时按其形状清零（形状不变时沿用
+    // 其内存）。OnRows 收到的矩阵为 acc，给出的是该发送方已并入的行前缀；
+    // OnMatrix 在一个发送方的矩阵全部并入后以空矩阵调用
+    void foldInto(oc::Matrix<block>& acc) { mFold = &acc; }
+
+    // done() 之后取走保留的连接
+    std::vector<int> takeConns();
+
+    // 所有矩阵都已收完且每条连接都收到了结束标记，或已经失败，或对端已全部关闭
+    bool done() const { return mFailed || mClosed || (mCompleted == mCount && mStreamsEnded == mStreamsTotal); }
+    bool ok() const { return !mFailed && !mClosed && mCompleted == mCount && mStreamsEnded == mStreamsTotal; }
+
+    // 在已有连接上接收时，所有连接都在连接头之前被对端关闭（常驻服务的子节点退出）
+    bool closed() const { return mClosed; }
+
+    // 本轮的轮次号，第一个连接头到达之后可用
+    uint64_t round() const { return mRound; }
+
+private:
+    // 一个发送方的矩阵，可能分在多条连接上
+    struct Transfer
+    {
+        uint64_t sender = 0;
+        uint64_t numStreams = 0;
+        uint64_t streamsSeen = 0;
+        uint64_t rows = 0;
+        oc::Matrix<block> M;
+        uint64_t rowBytes = 0;
+        uint64_t rowsGot = 0;
+        std::map<uint64_t, uint64_t> pending;   // 已收完但还接不上前缀的块 begin -> end
+        std::map<uint64_t, uint64_t> claimed;   // frontier 之后已收到块头的块（含正在收的）begin -> end
+        uint64_t frontier = 0;                  // [0, frontier) 行已收到
+        bool done = false;
+    };
+
+    // 一条连接：先收连接头，之后交替收块头和块数据
+    struct Conn
+    {
+        int fd = -1;
+        uint64_t hello[6];
+        uint64_t chunk[2];
+        Transfer* t = nullptr;
+        std::unique_ptr<block[]> stage;         // foldInto 时的暂存区
+        uint64_t stageBytes = 0;
+        uint64_t folded = 0;                    // 当前数据块已并入的行数
+    };
+
+    void acceptAll();
+    void onHello(size_t c, int res);
+    void readChunk(size_t c);
+    static bool overlapsClaimed(const Transfer& t, uint64_t begin, uint64_t end);
+    void onChunkHeader(size_t c, int res);
+    void onChunkData(size_t c, int res);
+    void readStage(size_t c);
+    void onStage(size_t c, int res);
+    void chunkDone(size_t c);
+    void readHello(size_t c);
+    void streamEnded(Conn& c);
+    void closeConn(Conn& c);
+    void fail(const std::string& why);
+    void stopAccepting();
+
+    IoLoop* mLoop = nullptr;
+    NodeListener* mListener = nullptr;
+    std::string mTag;
+    size_t mCount = 0;
+    size_t mCompleted = 0;
+    uint64_t mStreamsTotal = 0;     // 各发送方的 numStreams 之和
+    uint64_t mStreamsEnded = 0;
+    size_t mHelloEofs = 0;
+    uint64_t mRound = 0;
+    bool mRoundKnown = false;
+    bool mFailed = false;
+    bool mClosed = false;
+    bool mKeep = false;             // 连接不归本对象所有
+    bool mAccepting = false;
+    OnMatrix mOnMatrix;
+    OnRows mOnRows;
+    std::vector<oc::Matrix<block>>* mPool = nullptr;
+    oc::Matrix<block>* mFold = nullptr;
+
+    // 连接和发送方都只增不减，用 deque 保持元素地址不变
+    std::deque<Conn> mConns;
+    std::deque<Transfer> mTransfers;
+};
+
+// 在 loop 上用 MatrixReceiver 接收 count 个矩阵，返回时已全部收完或失败
+bool recvMatrices(IoLoop& loop, NodeListener& listener, size_t count,
+                  const MatrixReceiver::OnMatrix& onMatrix,
+                  const MatrixReceiver::OnRows& onRows = nullptr);
+
+// 连接到参与方 peerId 的监听端。对方尚未开始监听时每 100 ms 重试一次，
+// 直到 timeoutMs 为止。失败返回 -1。
+int connectToParty(const Topology& topo, uint64_t peerId, int timeoutMs = 30000);
+
+// 向 peerId 建立 topo.streams 条连接，供 MatrixStreamSender 条带化发送。
+// 任一条失败时关闭已建立的连接并返回空。
+std::vector<int> connectStreams(const Topology& topo, uint64_t peerId, int timeoutMs = 30000);
+
+void closeSockets(std::vector<int>& socks);
@@ -0,0 +1,420 @@
+// OkvsFile.cpp
+#include "OkvsFile.h"
+
+#include <iostream>
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cryptoTools/Crypto/RandomOracle.h>
+
+#include "BandOkvs.h"
+
+using namespace std;
+using namespace osuCrypto;
+using namespace volePSI;
+
+static const char gMagic[8] = { 'O', 'K', 'V', 'S', 'F', 'I', 'L', 'E' };
+
+static block digest(const void* data, uint64_t bytes)
+{
+    block d;
+    oc::RandomOracle ro(sizeof(block));
+    ro.Update(static_cast<const u8*>(data), bytes);
+    ro.Final(d);
+    return d;
+}
+
+// headerChecksum 覆盖它之前的所有字段
+static block headerDigest(const OkvsFile::Header& h)
+{
+    return digest(&h, offsetof(OkvsFile::Header, headerChecksum));
+}
+
+// 每 chunk 字节求一次摘要，再对摘要序列求摘要。各块可以独立（并行）计算。
+static block chunkedDigest(const uint8_t* data, uint64_t bytes, uint64_t chunk)
+{
+    std::vector<block> digests;
+    for (uint64_t off = 0; off < bytes; off += chunk)
+        digests.push_back(digest(data + off, std::min(chunk, bytes - off)));
+    return digest(digests.data(), digests.size() * sizeof(block));
+}
+
+// RB-OKVS 的行数必须与头部记录的带宽和 eps 一致
+static bool bandLayoutOk(const OkvsFile::Header& h)
+{
+    if (h.bandWidth != 64 && h.bandWidth != 128 && h.bandWidth != 256 && h.bandWidth != 512)
+        return false;
+    if (!(h.bandEpsilon >= 0))
+        return false;
+    BandParam bp;
+    bp.init(h.numItems, h.bandWidth, h.ssp, h.bandEpsilon);
+    return bp.size() == h.rows;
+}
+
+static void fillHeader(
+    OkvsFile::Header& h,
+    oc::MatrixView<const block> D,
+    uint64_t engine,
+    uint64_t bits,
+    uint64_t seed,
+    uint64_t numItems,
+    const PaxosParam& pp,
+    const OkvsFile::Params& params)
+{
+    static_assert(sizeof(OkvsFile::Header) <= OkvsFile::PageSize, "okvs file header must fit in a page");
+
+    h = {};
+    std::memcpy(h.magic, gMagic, sizeof(gMagic));
+    h.version       = OkvsFile::Version;
+    h.keysDigest    = params.keysDigest;
+    h.engine        = engine;
+    h.bits          = bits;
+    h.seed          = seed;
+    h.numItems      = numItems;
+    h.rows          = D.rows();
+    h.cols          = D.cols();
+    h.sparseSize    = pp.mSparseSize;
+    h.denseSize     = pp.mDenseSize;
+    h.weight        = pp.mWeight;
+    h.g             = pp.mG;
+    h.ssp           = pp.mSsp;
+    h.denseType     = pp.mDt;
+    h.hashMode      = static_cast<uint64_t>(pp.mHashMode);
+    h.bandWidth     = params.bandWidth;
+    h.bandEpsilon   = params.bandEpsilon;
+    h.baxosBinSize  = params.baxosBinSize;
+    h.dataOffset    = OkvsFile::PageSize;
+    h.dataBytes     = D.size() * sizeof(block);
+    h.checksumChunk = OkvsFileWriter::ChunkBytes;
+}
+
+OkvsFile::~OkvsFile()
+{
+    close();
+}
+
+void OkvsFile::close()
+{
+    if (mMap)
+        ::munmap(const_cast<uint8_t*>(mMap), mMapSize);
+    mMap = nullptr;
+    mMapSize = 0;
+}
+
+bool OkvsFile::write(
+    const std::string& path,
+    oc::MatrixView<const block> D,
+    uint64_t engine,
+    uint64_t bits,
+    uint64_t seed,
+    uint64_t numItems,
+    const PaxosParam& pp,
+    const Params& params)
+{
+    OkvsFileWriter writer(path, D, engine, bits, seed, numItems, pp, params);
+    if (!writer.ok())
+        return false;
+    writer.submit(0, D.rows());
+    return writer.finish();
+}
+
+bool OkvsFile::open(const std::string& path, bool populate, bool verifyData)
+{
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        cerr << "[OkvsFile] failed to open " << path << endl;
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || uint64_t(st.st_size) < PageSize) {
+        ::close(fd);
+        cerr << "[OkvsFile] " << path << " is too small" << endl;
+        return false;
+    }
+
+    uint64_t size = st.st_size;
+    int flags = MAP_SHARED | (populate ? MAP_POPULATE : 0);
+    auto ptr = ::mmap(nullptr, size, PROT_READ, flags, fd, 0);
+    ::close(fd);
+    if (ptr == MAP_FAILED) {
+        perror("[OkvsFile] mmap");
+        return false;
+    }
+
+    Header h;
+    std::memcpy(&h, ptr, sizeof(h));
+
+    const char* err = nullptr;
+    if (std::memcmp(h.magic, gMagic, sizeof(gMagic)) != 0)
+        err = "bad magic";
+    else if (h.version != Version)
+        err = "unsupported version";
+    else if (h.headerChecksum != headerDigest(h))
+        err = "header checksum mismatch";
+    else if (h.dataOffset % PageSize || h.dataBytes != h.rows * h.cols * sizeof(block) ||
+             h.dataOffset + h.dataBytes != size)
+        err = "bad layout";
+    else if (h.checksumChunk == 0 || h.checksumChunk % PageSize)
+        err = "bad checksum chunk size";
+    else if (h.hashMode != uint64_t(PaxosHashMode::LibDivide) && h.hashMode != uint64_t(PaxosHashMode::FastRange))
+        err = "unsupported hash mode";
+    else if (h.bandWidth && !bandLayoutOk(h))
+        err = "bad band parameters";
+    else if (h.baxosBinSize && (h.bandWidth || (h.baxosBinSize & (h.baxosBinSize - 1))))
+        err = "bad baxos bin size";
+    else if (verifyData && h.dataChecksum != chunkedDigest(static_cast<const uint8_t*>(ptr) + h.dataOffset, h.dataBytes, h.checksumChunk))
+        err = "data checksum mismatch";
+
+    if (err) {
+        cerr << "[OkvsFile] " << path << ": " << err << endl;
+        ::munmap(ptr, size);
+        return false;
+    }
+
+    if (!populate)
+        ::madvise(ptr, size, MADV_WILLNEED);
+
+    mHeader = h;
+    mMap = static_cast<const uint8_t*>(ptr);
+    mMapSize = size;
+    return true;
+}
+
+PaxosParam OkvsFile::paxosParam() const
+{
+    PaxosParam pp;
+    pp.mSparseSize = mHeader.sparseSize;
+    pp.mDenseSize  = mHeader.denseSize;
+    pp.mWeight     = mHeader.weight;
+    pp.mG          = mHeader.g;
+    pp.mSsp        = mHeader.ssp;
+    pp.mDt         = static_cast<PaxosParam::DenseType>(mHeader.denseType);
+    pp.mHashMode   = static_cast<PaxosHashMode>(mHeader.hashMode);
+    return pp;
+}
+
+// ====================== OkvsFileWriter ======================
+
+OkvsFileWriter::OkvsFileWriter(
+    const std::string& path,
+    oc::MatrixView<const block> D,
+    uint64_t engine,
+    uint64_t bits,
+    uint64_t seed,
+    uint64_t numItems,
+    const PaxosParam& pp,
+    const OkvsFile::Params& params,
+    size_t numThreads,
+    bool direct)
+    : mPath(path)
+    , mTmpPath(path + ".tmp." + std::to_string(::getpid()) + "." +
+        std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())))
+    , mD(D)
+{
+    static_assert(ChunkBytes % OkvsFile::PageSize == 0, "chunks must be page aligned");
+
+    fillHeader(mHeader, D, engine, bits, seed, numItems, pp, params);
+
+    int flags = O_WRONLY | O_CREAT | O_TRUNC;
+    if (direct) {
+        mFd = ::open(mTmpPath.c_str(), flags | O_DIRECT, 0644);
+        mDirect = mFd >= 0;
+    }
+    // tmpfs 等不支持 O_DIRECT 的文件系统上退回普通写
+    if (mFd < 0)
+        mFd = ::open(mTmpPath.c_str(), flags, 0644);
+    if (mFd < 0) {
+        cerr << "[OkvsFileWriter] failed to open " << mTmpPath << endl;
+        return;
+    }
+
+    // 预先分配空间，避免并发写时反复扩展文件
+    uint64_t fileSize = mHeader.dataOffset + mHeader.dataBytes;
+    if (fileSize)
+        ::posix_fallocate(mFd, 0, (fileSize + OkvsFile::PageSize - 1) / OkvsFile::PageSize * OkvsFile::PageSize);
+
+    mNumChunks = (mHeader.dataBytes + ChunkBytes - 1) / ChunkBytes;
+    mChunkReady.reset(new std::atomic<uint64_t>[mNumChunks]);
+    for (uint64_t c = 0; c < mNumChunks; ++c)
+        mChunkReady[c] = 0;
+    mChunkDigests.resize(mNumChunks);
+
+    numThreads = std::max<size_t>(1, std::min<size_t>(numThreads, mNumChunks));
+    for (size_t t = 0; t < numThreads; ++t)
+        mThreads.emplace_back([this] { workerLoop(); });
+}
+
+OkvsFileWriter::~OkvsFileWriter()
+{
+    if (mFd >= 0)
+        abort();
+}
+
+void OkvsFileWriter::abort()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMtx);
+        mStop = true;
+        mQueue.clear();
+    }
+    mCv.notify_all();
+    for (auto& th : mThreads)
+        th.join();
+    mThreads.clear();
+
+    ::close(mFd);
+    mFd = -1;
+    ::unlink(mTmpPath.c_str());
+}
+
+void OkvsFileWriter::submit(uint64_t rowBegin, uint64_t rowEnd)
+{
+    const uint64_t rowBytes = mHeader.cols * sizeof(block);
+    uint64_t begin = rowBegin * rowBytes;
+    uint64_t end = std::min(rowEnd * rowBytes, mHeader.dataBytes);
+    if (mFd < 0 || begin >= end)
+        return;
+
+    // 把提交的字节数记到覆盖的每个块上，块凑满时交给写线程
+    std::vector<uint64_t> full;
+    for (uint64_t c = begin / ChunkBytes; c * ChunkBytes < end; ++c) {
+        uint64_t cBegin = c * ChunkBytes;
+        uint64_t cEnd = std::min(cBegin + ChunkBytes, mHeader.dataBytes);
+        uint64_t n = std::min(end, cEnd) - std::max(begin, cBegin);
+        if (mChunkReady[c].fetch_add(n) + n == cEnd - cBegin)
+            full.push_back(c);
+    }
+
+    if (full.size()) {
+        {
+            std::lock_guard<std::mutex> lock(mMtx);
+            mQueue.insert(mQueue.end(), full.begin(), full.end());
+        }
+        mCv.notify_all();
+    }
+}
+
+void OkvsFileWriter::workerLoop()
+{
+    // O_DIRECT 要求用户缓冲区按页对齐；D 本身一般不满足，先拷到对齐的中转缓冲
+    std::unique_ptr<uint8_t, decltype(&std::free)> bounce(nullptr, &std::free);
+    if (mDirect)
+        bounce.reset(static_cast<uint8_t*>(std::aligned_alloc(OkvsFile::PageSize, ChunkBytes)));
+
+    while (true) {
+        uint64_t chunk;
+        {
+            std::unique_lock<std::mutex> lock(mMtx);
+            mCv.wait(lock, [&] { return mStop || !mQueue.empty(); });
+            if (mQueue.empty())
+                return;
+            chunk = mQueue.front();
+            mQueue.pop_front();
+        }
+
+        if (!mFailed && !writeChunk(chunk, bounce.get()))
+            mFailed = true;
+        ++mNumWritten;
+    }
+}
+
+bool OkvsFileWriter::pwriteAll(const void* data, uint64_t len, uint64_t offset)
+{
+    auto p = static_cast<const uint8_t*>(data);
+    while (len) {
+        ssize_t n = ::pwrite(mFd, p, len, offset);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("[OkvsFileWriter] pwrite");
+            return false;
+        }
+        p += n;
+        len -= n;
+        offset += n;
+    }
+    return true;
+}
+
+bool OkvsFileWriter::writeChunk(uint64_t chunk, uint8_t* bounce)
+{
+    uint64_t off = chunk * ChunkBytes;
+    uint64_t len = std::min(ChunkBytes, mHeader.dataBytes - off);
+    auto src = reinterpret_cast<const uint8_t*>(mD.data()) + off;
+
+    mChunkDigests[chunk] = digest(src, len);
+
+    if (!mDirect)
+        return pwriteAll(src, len, mHeader.dataOffset + off);
+
+    // 最后一块补零到整页，finish() 时再截断到真实大小
+    uint64_t padded = (len + OkvsFile::PageSize - 1) / OkvsFile::PageSize * OkvsFile::PageSize;
+    std::memcpy(bounce, src, len);
+    std::memset(bounce + len, 0, padded - len);
+    return pwriteAll(bounce, padded, mHeader.dataOffset + off);
+}
+
+bool OkvsFileWriter::finish()
+{
+    if (mFd < 0)
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(mMtx);
+        mStop = true;
+    }
+    mCv.notify_all();
+    for (auto& th : mThreads)
+        th.join();
+    mThreads.clear();
+
+    if (mNumWritten != mNumChunks) {
+        cerr << "[OkvsFileWriter] only " << mNumWritten << " of " << mNumChunks
+             << " chunks were submitted" << endl;
+        abort();
+        return false;
+    }
+    if (mFailed) {
+        cerr << "[OkvsFileWriter] failed to write " << mTmpPath << endl;
+        abort();
+        return false;
+    }
+
+    mHeader.dataChecksum = digest(mChunkDigests.data(), mChunkDigests.size() * sizeof(block));
+    mHeader.headerChecksum = headerDigest(mHeader);
+
+    std::unique_ptr<uint8_t, decltype(&std::free)> page(
+        static_cast<uint8_t*>(std::aligned_alloc(OkvsFile::PageSize, OkvsFile::PageSize)), &std::free);
+    std::memset(page.get(), 0, OkvsFile::PageSize);
+    std::memcpy(page.get(), &mHeader, sizeof(mHeader));
+
+    bool ok =
+        pwriteAll(page.get(), OkvsFile::PageSize, 0) &&
+        ::ftruncate(mFd, mHeader.dataOffset + mHeader.dataBytes) == 0 &&
+        ::fsync(mFd) == 0;
+    if (!ok) {
+        cerr << "[OkvsFileWriter] failed to finalize " << mTmpPath << endl;
+        abort();
+        return false;
+    }
+
+    ::close(mFd);
+    mFd = -1;
+    if (::rename(mTmpPath.c_str(), mPath.c_str()) != 0) {
+        perror("[OkvsFileWriter] rename");
+        ::unlink(mTmpPath.c_str());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,179 @@
+// OkvsFile.h
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <condition_variable>
+#include <cryptoTools/Common/Defines.h>
+#include <cryptoTools/Common/Matrix.h>
+#include "Paxos.h"
+
+using osuCrypto::block;
+
+// OKVS 矩阵 D 的磁盘格式，可直接 mmap 后解码，不经过任何拷贝。
+// 文件布局：[4 KiB 头][D，rows x cols 个 block，按页对齐]
+// 头部记录了解码所需的全部参数（PaxosParam、seed、IdxType 位宽、引擎及其参数），
+// 以及头部和数据各自的校验和。
+class OkvsFile
+{
+public:
+    struct Header
+    {
+        char     magic[8];
+        uint64_t version;
+        block    keysDigest;    // 编码所用 keys 的摘要，同 OkvsRowCache
+        uint64_t engine;        // OkvsEngine 的数值
+        uint64_t bits;          // Paxos 的 IdxType 位宽，RB-OKVS 为 0
+        uint64_t seed;
+        uint64_t numItems;
+        uint64_t rows;
+        uint64_t cols;
+        uint64_t sparseSize;
+        uint64_t denseSize;
+        uint64_t weight;
+        uint64_t g;
+        uint64_t ssp;
+        uint64_t denseType;
+        uint64_t hashMode;
+        uint64_t bandWidth;     // RB-OKVS 的带宽，其他引擎为 0
+        double   bandEpsilon;   // RB-OKVS 的 eps，其他引擎为 0
+        uint64_t baxosBinSize;  // Baxos 每个 bin 的 key 数，其他引擎为 0
+        uint64_t reserved;      // 为 0，使后面的 block 不需要填充
+        uint64_t dataOffset;
+        uint64_t dataBytes;
+        uint64_t checksumChunk; // 数据按该大小分块求摘要
+        block    dataChecksum;  // 各块 Blake2 摘要拼接后的 Blake2 摘要
+        block    headerChecksum; // 以上所有字段的 Blake2 摘要
+    };
+
+    // PaxosParam 之外的参数：由引擎决定的参数，以及 keys 的摘要
+    struct Params
+    {
+        uint64_t bandWidth = 0;
+        double   bandEpsilon = 0;
+        block    keysDigest = osuCrypto::ZeroBlock;
+        uint64_t baxosBinSize = 0;
+    };
+
+    static constexpr uint64_t Version = 5;
+    static constexpr uint64_t PageSize = 4096;
+
+    OkvsFile() = default;
+    ~OkvsFile();
+
+    OkvsFile(const OkvsFile&) = delete;
+    OkvsFile& operator=(const OkvsFile&) = delete;
+
+    // 写出 D（用 OkvsFileWriter 一次提交全部行）
+    static bool write(
+        const std::string& path,
+        oc::MatrixView<const block> D,
+        uint64_t engine,
+        uint64_t bits,
+        uint64_t seed,
+        uint64_t numItems,
+        const volePSI::PaxosParam& pp,
+        const Params& params = {});
+
+    // 只读 mmap。populate 时用 MAP_POPULATE 预先读入所有页；
+    // verifyData 时校验 D 的摘要（需要完整读一遍数据）。头部总是校验。
+    bool open(const std::string& path, bool populate = false, bool verifyData = true);
+
+    void close();
+
+    bool isOpen() const { return mMap != nullptr; }
+
+    const Header& header() const { return mHeader; }
+
+    // 由头部恢复出的 PaxosParam
+    volePSI::PaxosParam paxosParam() const;
+
+    // 由头部恢复出的引擎参数
+    Params params() const
+    {
+        return { mHeader.bandWidth, mHeader.bandEpsilon, mHeader.keysDigest, mHeader.baxosBinSize };
+    }
+
+    // open() 成功后可用，直接指向 mmap 的内存
+    oc::MatrixView<const block> matrix() const
+    {
+        return oc::MatrixView<const block>(
+            reinterpret_cast<const block*>(mMap + mHeader.dataOffset),
+            mHeader.rows, mHeader.cols);
+    }
+
+private:
+    Header mHeader{};
+    const uint8_t* mMap = nullptr;
+    uint64_t mMapSize = 0;
+};
+
+// 并行写出 OkvsFile。D 被切成 ChunkBytes 大小的块，某块的所有行都提交后
+// 由后台线程用 pwrite 写出（默认 O_DIRECT，不经过页缓存；文件系统不支持时
+// 退回普通写），最后写头部并只 fsync 一次。先写临时文件，finish() 时 rename。
+//
+// submit() 可以在任意线程、以任意顺序调用，因此可以与编码重叠：
+// 例如把 Baxos::mBinDone 接到 submit() 上，先解出的 bin 立刻落盘。
+// 调用者需保证 D 在 finish() 返回之前有效，且已提交的行不再修改。
+class OkvsFileWriter
+{
+public:
+    static constexpr uint64_t ChunkBytes = 8 << 20;
+
+    OkvsFileWriter(
+        const std::string& path,
+        oc::MatrixView<const block> D,
+        uint64_t engine,
+        uint64_t bits,
+        uint64_t seed,
+        uint64_t numItems,
+        const volePSI::PaxosParam& pp,
+        const OkvsFile::Params& params = {},
+        size_t numThreads = 4,
+        bool direct = true);
+
+    // 未 finish() 时放弃写入并删除临时文件
+    ~OkvsFileWriter();
+
+    OkvsFileWriter(const OkvsFileWriter&) = delete;
+    OkvsFileWriter& operator=(const OkvsFileWriter&) = delete;
+
+    // 临时文件是否成功创建
+    bool ok() const { return mFd >= 0; }
+
+    // D 的 [rowBegin, rowEnd) 行已经是最终值。同一行只能提交一次。
+    void submit(uint64_t rowBegin, uint64_t rowEnd);
+
+    // 等待所有块写完，写头部、fsync 并 rename。有行未提交或任一写入失败时返回 false。
+    bool finish();
+
+private:
+    void workerLoop();
+    bool writeChunk(uint64_t chunk, uint8_t* bounce);
+    bool pwriteAll(const void* data, uint64_t len, uint64_t offset);
+    void abort();
+
+    std::string mPath, mTmpPath;
+    oc::MatrixView<const block> mD;
+    OkvsFile::Header mHeader{};
+    int mFd = -1;
+    bool mDirect = false;
+
+    uint64_t mNumChunks = 0;
+    std::unique_ptr<std::atomic<uint64_t>[]> mChunkReady;  // 每块已提交的字节数
+    std::vector<block> mChunkDigests;
+    std::atomic<uint64_t> mNumWritten{ 0 };
+    std::atomic<bool> mFailed{ false };
+
+    std::mutex mMtx;
+    std::condition_variable mCv;
+    std::deque<uint64_t> mQueue;
+    bool mStop = false;
+    std::vector<std::thread> mThreads;
+};
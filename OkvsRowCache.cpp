@@ -0,0 +1,169 @@
+// OkvsRowCache.cpp
+#include "OkvsRowCache.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cryptoTools/Crypto/RandomOracle.h>
+
+using namespace std;
+using namespace osuCrypto;
+using namespace volePSI;
+
+static const char gMagic[8] = { 'O', 'K', 'V', 'S', 'R', 'O', 'W', 'S' };
+
+static uint64_t roundUpPage(uint64_t v)
+{
+    return (v + OkvsRowCache::PageSize - 1) / OkvsRowCache::PageSize * OkvsRowCache::PageSize;
+}
+
+block OkvsRowCache::keysDigest(const std::vector<block>& keys)
+{
+    block digest;
+    oc::RandomOracle ro(sizeof(block));
+    ro.Update(reinterpret_cast<const u8*>(keys.data()), keys.size() * sizeof(block));
+    ro.Final(digest);
+    return digest;
+}
+
+OkvsRowCache::OkvsRowCache(
+    const std::string& dir,
+    const std::vector<block>& keys,
+    u64 seed,
+    const PaxosParam& pp,
+    u64 idxBytes)
+    : mDir(dir)
+{
+    if (!enabled())
+        return;
+
+    static_assert(sizeof(Header) <= PageSize, "cache header must fit in a page");
+
+    std::memcpy(mHeader.magic, gMagic, sizeof(gMagic));
+    mHeader.version     = Version;
+    mHeader.keysDigest  = keysDigest(keys);
+    mHeader.seed        = seed;
+    mHeader.numItems    = keys.size();
+    mHeader.weight      = pp.mWeight;
+    mHeader.sparseSize  = pp.mSparseSize;
+    mHeader.denseSize   = pp.mDenseSize;
+    mHeader.ssp         = pp.mSsp;
+    mHeader.denseType   = pp.mDt;
+    mHeader.hashMode    = static_cast<uint64_t>(pp.mHashMode);
+    mHeader.idxBytes    = idxBytes;
+    mHeader.rowsOffset  = PageSize;
+    mHeader.denseOffset = roundUpPage(mHeader.rowsOffset + mHeader.numItems * mHeader.weight * idxBytes);
+    mHeader.fileSize    = mHeader.denseOffset + mHeader.numItems * sizeof(block);
+
+    // 文件名 = 整个头部的摘要
+    block name;
+    {
+        oc::RandomOracle ro(sizeof(block));
+        ro.Update(reinterpret_cast<const u8*>(&mHeader), sizeof(mHeader));
+        ro.Final(name);
+    }
+
+    std::stringstream ss;
+    ss << mDir << "/rows_" << std::hex << std::setfill('0')
+       << std::setw(16) << name.get<u64>(1)
+       << std::setw(16) << name.get<u64>(0) << ".bin";
+    mPath = ss.str();
+}
+
+OkvsRowCache::~OkvsRowCache()
+{
+    if (mMap)
+        ::munmap(const_cast<uint8_t*>(mMap), mMapSize);
+}
+
+bool OkvsRowCache::load()
+{
+    if (!enabled() || mMap)
+        return mMap != nullptr;
+
+    int fd = ::open(mPath.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || uint64_t(st.st_size) != mHeader.fileSize) {
+        ::close(fd);
+        return false;
+    }
+
+    auto ptr = ::mmap(nullptr, mHeader.fileSize, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (ptr == MAP_FAILED)
+        return false;
+
+    // 摘要冲突或文件被改过：头部必须与当前输入完全一致
+    if (std::memcmp(ptr, &mHeader, sizeof(mHeader)) != 0) {
+        cerr << "[OkvsRowCache] stale cache file " << mPath << ", ignoring" << endl;
+        ::munmap(ptr, mHeader.fileSize);
+        return false;
+    }
+
+    mMap = static_cast<const uint8_t*>(ptr);
+    mMapSize = mHeader.fileSize;
+    return true;
+}
+
+bool OkvsRowCache::store(const void* rows, u64 rowsBytes, oc::span<const block> dense)
+{
+    if (!enabled())
+        return false;
+
+    if (rowsBytes != mHeader.numItems * mHeader.weight * mHeader.idxBytes ||
+        dense.size() != mHeader.numItems) {
+        cerr << "[OkvsRowCache] store: size mismatch" << endl;
+        return false;
+    }
+
+    ::mkdir(mDir.c_str(), 0755);
+
+    // 同一进程内多个参与方可能同时写同一个缓存，临时文件名带上线程
+    auto tmpPath = mPath + ".tmp." + std::to_string(::getpid()) + "." +
+        std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    {
+        ofstream out(tmpPath, ios::binary);
+        if (!out.is_open()) {
+            cerr << "[OkvsRowCache] failed to open " << tmpPath << endl;
+            return false;
+        }
+
+        std::vector<char> pad(PageSize, 0);
+        std::memcpy(pad.data(), &mHeader, sizeof(mHeader));
+        out.write(pad.data(), PageSize);
+
+        out.write(static_cast<const char*>(rows), rowsBytes);
+        // 补齐到 dense 所在的页
+        auto rowsEnd = mHeader.rowsOffset + rowsBytes;
+        std::fill(pad.begin(), pad.end(), 0);
+        out.write(pad.data(), mHeader.denseOffset - rowsEnd);
+
+        out.write(reinterpret_cast<const char*>(dense.data()), dense.size_bytes());
+
+        if (!out.good()) {
+            cerr << "[OkvsRowCache] failed to write " << tmpPath << endl;
+            out.close();
+            ::unlink(tmpPath.c_str());
+            return false;
+        }
+    }
+
+    if (::rename(tmpPath.c_str(), mPath.c_str()) != 0) {
+        perror("[OkvsRowCache] rename");
+        ::unlink(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
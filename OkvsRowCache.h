@@ -0,0 +1,89 @@
+// OkvsRowCache.h
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cryptoTools/Common/Defines.h>
+#include <cryptoTools/Common/Matrix.h>
+#include "Paxos.h"
+
+using osuCrypto::block;
+
+// 哈希行缓存：把 Paxos 的 (rows, dense) 持久化到磁盘。
+// 文件名由 (keys 内容摘要, seed, PaxosParam, hash mode, IdxType 宽度) 决定，
+// 任一输入变化都会落到另一个文件上，因此旧缓存自动失效。
+// 文件布局：[4 KiB 头][rows, 按页对齐][dense, 按页对齐]，可直接 mmap 使用。
+class OkvsRowCache
+{
+public:
+    struct Header
+    {
+        char     magic[8];
+        uint64_t version;
+        block    keysDigest;
+        uint64_t seed;
+        uint64_t numItems;
+        uint64_t weight;
+        uint64_t sparseSize;
+        uint64_t denseSize;
+        uint64_t ssp;
+        uint64_t denseType;
+        uint64_t hashMode;
+        uint64_t idxBytes;
+        uint64_t rowsOffset;
+        uint64_t denseOffset;
+        uint64_t fileSize;
+    };
+
+    static constexpr uint64_t Version = 1;
+    static constexpr uint64_t PageSize = 4096;
+
+    // keys 的摘要。同一批 key 无论 csv 怎么排版都会得到同一个摘要。
+    // OkvsFile 也用它记录 D 是由哪批 key 编码的。
+    static block keysDigest(const std::vector<block>& keys);
+
+    // dir 为空表示关闭缓存。构造时会对 keys 求摘要。
+    OkvsRowCache(
+        const std::string& dir,
+        const std::vector<block>& keys,
+        osuCrypto::u64 seed,
+        const volePSI::PaxosParam& pp,
+        osuCrypto::u64 idxBytes);
+    ~OkvsRowCache();
+
+    OkvsRowCache(const OkvsRowCache&) = delete;
+    OkvsRowCache& operator=(const OkvsRowCache&) = delete;
+
+    bool enabled() const { return !mDir.empty(); }
+
+    // 缓存文件路径（内容寻址）
+    const std::string& path() const { return mPath; }
+
+    // mmap 缓存文件。文件不存在或头部与当前输入不符时返回 false。
+    bool load();
+
+    // 把 rows/dense 写入缓存：先写临时文件再 rename，写一半的文件不会被读到。
+    bool store(const void* rows, osuCrypto::u64 rowsBytes, oc::span<const block> dense);
+
+    // load() 成功后可用，直接指向 mmap 的内存
+    template<typename T>
+    oc::MatrixView<const T> rows() const
+    {
+        return oc::MatrixView<const T>(
+            reinterpret_cast<const T*>(mMap + mHeader.rowsOffset),
+            mHeader.numItems, mHeader.weight);
+    }
+
+    oc::span<const block> dense() const
+    {
+        return oc::span<const block>(
+            reinterpret_cast<const block*>(mMap + mHeader.denseOffset),
+            mHeader.numItems);
+    }
+
+private:
+    std::string mDir, mPath;
+    Header mHeader{};
+    const uint8_t* mMap = nullptr;
+    uint64_t mMapSize = 0;
+};
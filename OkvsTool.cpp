@@ -1,5 +1,8 @@
 // OkvsTool.cpp
 #include "OkvsTool.h"
+#include "BandOkvs.h"
+#include "OkvsRowCache.h"
+#include "ValuePrf.h"
 
 #include <iostream>
 #include <fstream>
@@ -7,6 +10,15 @@
 #include <string>
 #include <vector>
 #include <cstring>  // std::memcpy
+#include <thread>
+#include <numeric>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <immintrin.h>
 
 #include <cryptoTools/Crypto/PRNG.h>      // PRNG
 #include <cryptoTools/Common/Defines.h>   // toBlock
@@ -18,132 +30,262 @@ using namespace oc;
 using namespace volePSI;
 
 
-#include <openssl/evp.h>
-
-static uint64_t hashKeyToValue(const block& key, const block& secret)
+void generateValues(const vector<block>& keys, oc::Matrix<block>& vals, ValuePrf prf, size_t numThreads, u64 round)
 {
-    uint8_t buf[32]; // SHA256 输出
-    unsigned int len = 0;
+    // 固定密钥（用户可以替换）；第 0 轮与旧版本一致
+    block secret = oc::toBlock(0x12345678, 0x90abcdef) ^ oc::toBlock(round, 0);
 
-    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
-    if (!ctx) throw std::runtime_error("EVP_MD_CTX_new failed");
+    vals.resize(keys.size(), 1, oc::AllocType::Uninitialized);
+    deriveValues(keys, span<block>(vals.data(), vals.size()), secret, prf, numThreads);
+}
 
-    // 初始化：使用 SHA256
-    if (EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr) != 1)
-        throw std::runtime_error("DigestInit failed");
+// ====================== keys.csv 高速读取 ======================
+
+namespace
+{
+    // 解析十进制数字串 [b, e)，不接受除数字外的任何字符。
+    inline bool parseDecimalScalar(const char* b, const char* e, uint64_t& out)
+    {
+        uint64_t v = 0;
+        for (; b != e; ++b) {
+            unsigned d = static_cast<unsigned char>(*b) - '0';
+            if (d > 9 ||
+                __builtin_mul_overflow(v, 10, &v) ||
+                __builtin_add_overflow(v, d, &v))
+                return false;
+        }
+        out = v;
+        return true;
+    }
 
-    // 固定密钥
-    if (EVP_DigestUpdate(ctx, &secret, sizeof(block)) != 1)
-        throw std::runtime_error("DigestUpdate secret failed");
+#ifdef __SSE4_1__
+    // 一次解析以 e 结尾的 len (1..16) 位数字。调用者保证 [e-16, e) 可读。
+    inline bool parseDecimal16(const char* e, size_t len, uint64_t& out)
+    {
+        const __m128i zero = _mm_set1_epi8('0');
+        const __m128i nine = _mm_set1_epi8(9);
+        const __m128i idx = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
 
-    // key
-    if (EVP_DigestUpdate(ctx, &key, sizeof(block)) != 1)
-        throw std::runtime_error("DigestUpdate key failed");
+        __m128i v = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(e - 16)), zero);
 
-    // 输出 hash
-    if (EVP_DigestFinal_ex(ctx, buf, &len) != 1)
-        throw std::runtime_error("DigestFinal failed");
+        // 只有最后 len 个字节属于这个数
+        __m128i keep = _mm_cmpgt_epi8(idx, _mm_set1_epi8(static_cast<char>(15 - len)));
+        __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(v, nine), v);
+        if (_mm_movemask_epi8(_mm_andnot_si128(isDigit, keep)))
+            return false;
+        v = _mm_and_si128(v, keep);
 
-    EVP_MD_CTX_free(ctx);
+        // 2 位 -> 4 位 -> 8 位
+        __m128i t1 = _mm_maddubs_epi16(v, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+        __m128i t2 = _mm_madd_epi16(t1, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+        __m128i t3 = _mm_packus_epi32(t2, t2);
+        __m128i t4 = _mm_madd_epi16(t3, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
 
-    // 取前 8 字节得到 uint64_t
-    uint64_t val;
-    memcpy(&val, buf, sizeof(uint64_t));
-    return val;
-}
+        uint64_t hi = static_cast<uint32_t>(_mm_cvtsi128_si32(t4));
+        uint64_t lo = static_cast<uint32_t>(_mm_extract_epi32(t4, 1));
+        out = hi * 100000000ull + lo;
+        return true;
+    }
+#endif
 
+    // 解析一行中去掉首尾空白后的数字串 [b, e)。fileBegin 用来判断能否向前多读。
+    inline bool parseKey(const char* b, const char* e, const char* fileBegin, uint64_t& out)
+    {
+        size_t len = e - b;
+        if (len == 0 || len > 20)
+            return false;
 
-static bool generateAndSaveValues(const vector<block>& keys,
-                                  const string& valPath)
-{
-    cout << "Generating deterministic encrypted values..." << endl;
+#ifdef __SSE4_1__
+        if (e - 16 >= fileBegin) {
+            if (len <= 16)
+                return parseDecimal16(e, len, out);
 
-    ofstream valFile(valPath);
-    if (!valFile.is_open()) {
-        cerr << "Failed to open " << valPath << endl;
-        return false;
+            // 17..20 位：前面的几位走标量，后 16 位走 SIMD
+            uint64_t head, tail;
+            if (!parseDecimalScalar(b, e - 16, head) || !parseDecimal16(e, 16, tail))
+                return false;
+            return !__builtin_mul_overflow(head, 10000000000000000ull, &out) &&
+                   !__builtin_add_overflow(out, tail, &out);
+        }
+#endif
+        return parseDecimalScalar(b, e, out);
     }
 
-    // 固定密钥（用户可以替换）
-    block secret = oc::toBlock(0x12345678, 0x90abcdef);
-
-    for (size_t i = 0; i < keys.size(); ++i) {
-        uint64_t val = hashKeyToValue(keys[i], secret);
-        valFile << val << "\n";
+    inline bool isBlank(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r';
     }
 
-    cout << "Done. Saved " << keys.size() << " values." << endl;
-    return true;
+    struct BadLine
+    {
+        size_t lineNo;
+        string text;
+    };
 }
 
-bool loadKeysAndGenerateValues(
+bool loadKeysFromCsv(
     std::vector<block>& keys,
-    oc::Matrix<block>& vals,
     const std::string& keyPath,
-    const std::string& valPath)
+    size_t numThreads)
 {
-    // 1. 读取 keys
-    ifstream keyFile(keyPath);
-    if (!keyFile.is_open()) {
+    auto start = chrono::steady_clock::now();
+
+    int fd = ::open(keyPath.c_str(), O_RDONLY);
+    if (fd < 0) {
         cerr << "Failed to open " << keyPath << endl;
         return false;
     }
 
-    vector<uint64_t> keyInts;
-    uint64_t k;
-    string line;
-    while (getline(keyFile, line)) {
-        if (!line.empty()) {
-            k = stoull(line);
-            keyInts.push_back(k);
-        }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        cerr << "No keys found in " << keyPath << endl;
+        return false;
     }
-    keyFile.close();
 
-    if (keyInts.empty()) {
-        cerr << "No keys found in " << keyPath << endl;
+    size_t size = st.st_size;
+    void* map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        perror("mmap keys");
         return false;
     }
+    ::madvise(map, size, MADV_SEQUENTIAL);
 
-    size_t n = keyInts.size();
-    keys.resize(n);
+    const char* begin = static_cast<const char*>(map);
+    const char* end = begin + size;
+
+    // 按 1 MiB 以上切分，每段的边界对齐到换行符之后
+    if (numThreads == 0)
+        numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    numThreads = std::max<size_t>(1, std::min<size_t>(numThreads, size / (1 << 20) + 1));
 
-    // 转成 block
-    for (size_t i = 0; i < n; ++i) {
-        keys[i] = toBlock(keyInts[i]);
+    vector<const char*> bounds(numThreads + 1);
+    bounds[0] = begin;
+    bounds[numThreads] = end;
+    for (size_t t = 1; t < numThreads; ++t) {
+        auto p = std::max(bounds[t - 1], begin + size * t / numThreads);
+        auto nl = static_cast<const char*>(memchr(p, '\n', end - p));
+        bounds[t] = nl ? nl + 1 : end;
     }
 
-    cout << "Successfully loaded " << n << " keys." << endl;
+    // 第一遍：统计每段的行数，作为该段写入位置的上界
+    vector<size_t> lineBase(numThreads + 1, 0);
+    auto countLines = [&](size_t t) {
+        auto b = bounds[t], e = bounds[t + 1];
+        size_t n = std::count(b, e, '\n');
+        if (e == end && b != e && e[-1] != '\n')
+            ++n;
+        lineBase[t + 1] = n;
+    };
 
-    // 2. 根据 keys 生成并保存 values
-    if (!generateAndSaveValues(keys, valPath)) {
-        cerr << "Failed to generate values" << endl;
-        return false;
+    // 第二遍：解析并直接写入 keys[lineBase[t] ...]
+    vector<size_t> numRows(numThreads, 0), numBad(numThreads, 0);
+    vector<vector<BadLine>> badLines(numThreads);
+    auto parse = [&](size_t t) {
+        auto iter = bounds[t], e = bounds[t + 1];
+        auto out = keys.data() + lineBase[t];
+        size_t lineNo = lineBase[t];
+        size_t rows = 0;
+
+        while (iter < e) {
+            auto nl = static_cast<const char*>(memchr(iter, '\n', e - iter));
+            auto lineEnd = nl ? nl : e;
+            ++lineNo;
+
+            auto b = iter, le = lineEnd;
+            while (b < le && isBlank(*b)) ++b;
+            while (le > b && isBlank(le[-1])) --le;
+
+            if (b != le) {
+                uint64_t v;
+                if (parseKey(b, le, begin, v)) {
+                    out[rows++] = toBlock(v);
+                } else if (numBad[t]++ < 5) {
+                    badLines[t].push_back({ lineNo, string(b, std::min<size_t>(le - b, 40)) });
+                }
+            }
+            if (!nl)
+                break;
+            iter = nl + 1;
+        }
+        numRows[t] = rows;
+    };
+
+    auto runAll = [&](auto& fn) {
+        vector<std::thread> thrds(numThreads - 1);
+        for (size_t t = 0; t < thrds.size(); ++t)
+            thrds[t] = std::thread(fn, t);
+        fn(thrds.size());
+        for (auto& th : thrds)
+            th.join();
+    };
+
+    runAll(countLines);
+    for (size_t t = 0; t < numThreads; ++t)
+        lineBase[t + 1] += lineBase[t];
+
+    keys.resize(lineBase[numThreads]);
+    runAll(parse);
+    ::munmap(map, size);
+
+    // 跳过的空行/错误行会在各段末尾留下空洞，把各段前移拼接起来
+    size_t n = numRows[0];
+    for (size_t t = 1; t < numThreads; ++t) {
+        if (n != lineBase[t])
+            std::copy(keys.begin() + lineBase[t], keys.begin() + lineBase[t] + numRows[t], keys.begin() + n);
+        n += numRows[t];
     }
+    keys.resize(n);
 
-    // 3. 再从 valPath 读回生成好的 values
-    ifstream valFile(valPath);
-    if (!valFile.is_open()) {
-        cerr << "Failed to open generated " << valPath << endl;
-        return false;
+    size_t bad = std::accumulate(numBad.begin(), numBad.end(), size_t(0));
+    if (bad) {
+        cerr << "Skipped " << bad << " malformed line(s) in " << keyPath << ":" << endl;
+        for (auto& lines : badLines)
+            for (auto& l : lines)
+                cerr << "  line " << l.lineNo << ": \"" << l.text << "\"" << endl;
     }
 
-    vector<uint64_t> valInts;
-    uint64_t v;
-    while (getline(valFile, line)) {
-        if (!line.empty()) {
-            v = stoull(line);
-            valInts.push_back(v);
-        }
+    if (keys.empty()) {
+        cerr << "No keys found in " << keyPath << endl;
+        return false;
     }
-    valFile.close();
 
-    vals.resize(n, 1);
-    for (size_t i = 0; i < n; ++i) {
-        vals(i, 0) = toBlock(valInts[i]);
+    double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "Parsed " << n << " keys from " << keyPath << " in " << sec * 1000 << " ms ("
+         << n / sec / 1e6 << " M rows/s, " << size / sec / (1 << 20) << " MB/s, "
+         << numThreads << " threads)" << endl;
+    return true;
+}
+
+bool loadKeysAndGenerateValues(
+    std::vector<block>& keys,
+    oc::Matrix<block>& vals,
+    const std::string& keyPath,
+    const std::string& valPath,
+    std::future<bool>* valSaved)
+{
+    // 1. 读取 keys
+    if (!loadKeysFromCsv(keys, keyPath))
+        return false;
+
+    size_t n = keys.size();
+    cout << "Successfully loaded " << n << " keys." << endl;
+
+    // 2. 直接在内存中生成 values，不再经过 values.csv
+    cout << "Generating deterministic encrypted values..." << endl;
+    generateValues(keys, vals);
+    cout << "Done. Generated " << n << " values." << endl;
+
+    // 3. 可选：后台把 values 以二进制写出，不阻塞后续的编码
+    if (!valPath.empty()) {
+        auto fu = saveMatrixToFileAsync(vals, valPath);
+        if (valSaved)
+            *valSaved = std::move(fu);
+        else if (!fu.get())
+            return false;
     }
 
-    cout << "Successfully loaded " << n << " generated values." << endl;
     return true;
 }
 
@@ -175,6 +317,13 @@ bool saveMatrixToFile(const oc::Matrix<block>& M, const std::string& path)
     return true;
 }
 
+std::future<bool> saveMatrixToFileAsync(const oc::Matrix<block>& M, const std::string& path)
+{
+    return std::async(std::launch::async, [&M, path]() {
+        return saveMatrixToFile(M, path);
+    });
+}
+
 // 从文件读取 oc::Matrix<block>，格式同上
 bool loadMatrixFromFile(oc::Matrix<block>& M, const std::string& path)
 {
@@ -201,20 +350,74 @@ bool loadMatrixFromFile(oc::Matrix<block>& M, const std::string& path)
     return true;
 }
 
+// 定义在 Baxos 部分之后
+static OkvsFile::Params fileParamsOf(OkvsEngine engine, u64 n, const PaxosParam& pp,
+                                     const vector<block>* keys = nullptr);
+
+bool saveOKVSToFile(
+    const oc::Matrix<block>& D,
+    const std::string& path,
+    int bits,
+    const vector<block>& keys,
+    const PaxosParam& pp,
+    u64 seed,
+    OkvsEngine engine)
+{
+    // 只有 Paxos 使用调用者指定的 IdxType
+    uint64_t idxBits = engine == OkvsEngine::Paxos ? bits : 0;
+    return OkvsFile::write(path, D, static_cast<uint64_t>(engine), idxBits, seed, keys.size(), pp,
+        fileParamsOf(engine, keys.size(), pp, &keys));
+}
+
 // ====================== OKVS 编码/解码模板实现 ======================
 
+// 设置 paxos 的输入。行缓存命中时直接使用 mmap 的 rows/dense，跳过 AES 哈希和 buildRow；
+// 未命中时正常哈希，并把结果写入缓存供下次使用。
+template<typename T>
+static void setInputCached(
+    Paxos<T>& paxos,
+    const vector<block>& keys,
+    const PaxosParam& pp,
+    u64 seed,
+    const string& rowCacheDir)
+{
+    OkvsRowCache cache(rowCacheDir, keys, seed, pp, sizeof(T));
+
+    Timer timer;
+    auto start = timer.setTimePoint("start");
+    bool hit = cache.load();
+    if (hit)
+        paxos.setInput(cache.rows<T>(), cache.dense());
+    else
+        paxos.setInput(keys);
+    auto end = timer.setTimePoint("end");
+
+    double ms = chrono::duration_cast<chrono::microseconds>(end - start).count() / 1000.0;
+    if (!cache.enabled())
+        return;
+
+    if (hit) {
+        cout << "[rowCache] hit " << cache.path() << ", setInput: " << ms << " ms" << endl;
+    } else {
+        cout << "[rowCache] miss, setInput: " << ms << " ms" << endl;
+        if (cache.store(paxos.mRows.data(), paxos.mRows.size() * sizeof(T), paxos.mDense))
+            cout << "[rowCache] stored " << cache.path() << endl;
+    }
+}
+
 template<typename T>
 static bool encodeOKVS_impl(
     const vector<block>& keys,
     const oc::Matrix<block>& vals,
     oc::Matrix<block>& okvs_out,
     PaxosParam& pp,
-    u64 seed)
+    u64 seed,
+    const string& rowCacheDir)
 {
     try {
         Paxos<T> paxos;
         paxos.init(keys.size(), pp, block(seed, seed));
-        paxos.setInput(keys);
+        setInputCached(paxos, keys, pp, seed, rowCacheDir);
 
         size_t rows = pp.size();
         size_t cols = vals.cols();
@@ -239,10 +442,11 @@ static bool encodeOKVS_impl(
 template<typename T>
 static bool decodeOKVS_impl(
     const vector<block>& keys,
-    const oc::Matrix<block>& okvs_in,
+    oc::MatrixView<const block> okvs_in,
     oc::Matrix<block>& vals_out,
     PaxosParam& pp,
-    u64 seed)
+    u64 seed,
+    const string& rowCacheDir)
 {
     try {
         // 初始化阶段（不计入decode时间）
@@ -253,10 +457,26 @@ static bool decodeOKVS_impl(
         size_t cols = okvs_in.cols();
         vals_out.resize(rows, cols);
 
+        // 行缓存未命中时先算出 rows/dense 并写入缓存（同样不计入decode时间）
+        OkvsRowCache cache(rowCacheDir, keys, seed, pp, sizeof(T));
+        if (cache.enabled() && !cache.load()) {
+            oc::Matrix<T> hashedRows(rows, pp.mWeight);
+            vector<block> dense(rows);
+            paxos.hashBuildRows(keys, hashedRows, dense);
+            if (cache.store(hashedRows.data(), hashedRows.size() * sizeof(T), dense))
+                cout << "[rowCache] stored " << cache.path() << endl;
+        }
+        bool hit = cache.load();
+        if (hit)
+            cout << "[rowCache] hit " << cache.path() << endl;
+
         // 使用Timer测量纯decode时间（与main.cpp一致）
         Timer timer;
         auto decode_start = timer.setTimePoint("decode_start");
-        paxos.template decode<block>(keys, vals_out, okvs_in);
+        if (hit)
+            paxos.template decodeRows<block>(cache.rows<T>(), cache.dense(), vals_out, okvs_in);
+        else
+            paxos.template decode<block>(keys, vals_out, okvs_in);
         auto decode_end = timer.setTimePoint("decode_end");
 
         double ms = chrono::duration_cast<chrono::microseconds>(decode_end - decode_start).count() / 1000.0;
@@ -268,42 +488,600 @@ static bool decodeOKVS_impl(
     }
 }
 
+// ====================== RB-OKVS 编码/解码 ======================
+
+static u64 bandWidthOf(OkvsEngine engine)
+{
+    switch (engine) {
+    case OkvsEngine::Band64:  return 64;
+    case OkvsEngine::Band128: return 128;
+    case OkvsEngine::Band256: return 256;
+    default:                  return 512;
+    }
+}
+
+static bool encodeBandOKVS_impl(
+    const vector<block>& keys,
+    const oc::Matrix<block>& vals,
+    oc::Matrix<block>& okvs_out,
+    PaxosParam& pp,
+    u64 seed,
+    OkvsEngine engine)
+{
+    try {
+        BandOkvs okvs;
+        okvs.init(keys.size(), bandWidthOf(engine), pp.mSsp, block(seed, seed));
+        okvs.setInput(keys);
+
+        size_t rows = okvs.size();
+        size_t cols = vals.cols();
+        okvs_out.resize(rows, cols);
+
+        Timer timer;
+        auto encode_start = timer.setTimePoint("encode_start");
+        okvs.encode<block>(vals, okvs_out);
+        auto encode_end = timer.setTimePoint("encode_end");
+
+        double ms = chrono::duration_cast<chrono::microseconds>(encode_end - encode_start).count() / 1000.0;
+        cout << "[encodeBandOKVS_impl] encode time: " << ms << " ms" << endl;
+        double D_size_MB = (rows * cols * sizeof(block)) / (1024.0 * 1024.0);
+        cout << "[encodeBandOKVS_impl] OKVS D size: " << D_size_MB << " MB, e = "
+             << double(rows) / keys.size() << endl;
+        return true;
+    } catch (const exception& e) {
+        cerr << "encodeBandOKVS_impl exception: " << e.what() << endl;
+        return false;
+    }
+}
+
+static bool decodeBandOKVS_impl(
+    const vector<block>& keys,
+    oc::MatrixView<const block> okvs_in,
+    oc::Matrix<block>& vals_out,
+    PaxosParam& pp,
+    u64 seed,
+    OkvsEngine engine)
+{
+    try {
+        BandOkvs okvs;
+        okvs.init(keys.size(), bandWidthOf(engine), pp.mSsp, block(seed, seed));
+
+        size_t rows = keys.size();
+        size_t cols = okvs_in.cols();
+        vals_out.resize(rows, cols);
+
+        Timer timer;
+        auto decode_start = timer.setTimePoint("decode_start");
+        okvs.decode<block>(keys, vals_out, okvs_in);
+        auto decode_end = timer.setTimePoint("decode_end");
+
+        double ms = chrono::duration_cast<chrono::microseconds>(decode_end - decode_start).count() / 1000.0;
+        cout << "[decodeBandOKVS_impl] decode time: " << ms << " ms" << endl;
+        return true;
+    } catch (const exception& e) {
+        cerr << "decodeBandOKVS_impl exception: " << e.what() << endl;
+        return false;
+    }
+}
+
+// ====================== Baxos 编码/解码 ======================
+
+static const u64 gBaxosBinSize = 1 << 14;
+
+static void initBaxos(Baxos& okvs, u64 n, const PaxosParam& pp, u64 seed)
+{
+    okvs.init(n, gBaxosBinSize, pp.mWeight, pp.mSsp, pp.mDt, block(seed, seed), pp.mHashMode);
+}
+
+static u64 baxosThreads()
+{
+    return std::max<u64>(1, std::thread::hardware_concurrency());
+}
+
+// 写入 OkvsFile 头部的引擎参数，与编码时使用的一致。keys 为空时只填引擎参数
+static OkvsFile::Params fileParamsOf(OkvsEngine engine, u64 n, const PaxosParam& pp,
+                                     const vector<block>* keys)
+{
+    OkvsFile::Params params;
+    if (keys)
+        params.keysDigest = OkvsRowCache::keysDigest(*keys);
+    if (engine == OkvsEngine::Baxos)
+        params.baxosBinSize = gBaxosBinSize;
+    else if (engine != OkvsEngine::Paxos) {
+        BandParam bp(n, bandWidthOf(engine), pp.mSsp);
+        params.bandWidth = bp.mBandWidth;
+        params.bandEpsilon = bp.mEpsilon;
+    }
+    return params;
+}
+
+// rowsDone 非空时，每个 bin 解出后立刻以该 bin 的行区间调用（来自求解线程）
+static bool encodeBaxosOKVS_impl(
+    const vector<block>& keys,
+    const oc::Matrix<block>& vals,
+    oc::Matrix<block>& okvs_out,
+    PaxosParam& pp,
+    u64 seed,
+    const std::function<void(u64, u64)>& rowsDone = nullptr)
+{
+    try {
+        Baxos okvs;
+        initBaxos(okvs, keys.size(), pp, seed);
+        okvs.mBinDone = rowsDone;
+
+        size_t rows = okvs.size();
+        size_t cols = vals.cols();
+        if (okvs_out.rows() != rows || okvs_out.cols() != cols)
+            okvs_out.resize(rows, cols);
+
+        Timer timer;
+        auto encode_start = timer.setTimePoint("encode_start");
+        okvs.solve<block>(keys, vals, okvs_out, nullptr, baxosThreads());
+        auto encode_end = timer.setTimePoint("encode_end");
+
+        double ms = chrono::duration_cast<chrono::microseconds>(encode_end - encode_start).count() / 1000.0;
+        cout << "[encodeBaxosOKVS_impl] encode time: " << ms << " ms, " << okvs.mNumBins << " bins" << endl;
+        double D_size_MB = (rows * cols * sizeof(block)) / (1024.0 * 1024.0);
+        cout << "[encodeBaxosOKVS_impl] OKVS D size: " << D_size_MB << " MB, e = "
+             << double(rows) / keys.size() << endl;
+        return true;
+    } catch (const exception& e) {
+        cerr << "encodeBaxosOKVS_impl exception: " << e.what() << endl;
+        return false;
+    }
+}
+
+static bool decodeBaxosOKVS_impl(
+    const vector<block>& keys,
+    oc::MatrixView<const block> okvs_in,
+    oc::Matrix<block>& vals_out,
+    PaxosParam& pp,
+    u64 seed)
+{
+    try {
+        Baxos okvs;
+        initBaxos(okvs, keys.size(), pp, seed);
+
+        size_t rows = keys.size();
+        size_t cols = okvs_in.cols();
+        vals_out.resize(rows, cols);
+
+        Timer timer;
+        auto decode_start = timer.setTimePoint("decode_start");
+        okvs.decode<block>(keys, vals_out, okvs_in, baxosThreads());
+        auto decode_end = timer.setTimePoint("decode_end");
+
+        double ms = chrono::duration_cast<chrono::microseconds>(decode_end - decode_start).count() / 1000.0;
+        cout << "[decodeBaxosOKVS_impl] decode time: " << ms << " ms" << endl;
+        return true;
+    } catch (const exception& e) {
+        cerr << "decodeBaxosOKVS_impl exception: " << e.what() << endl;
+        return false;
+    }
+}
+
+void BaxosBinDecoder::init(const vector<block>& keys, const PaxosParam& pp, u64 seed)
+{
+    initBaxos(mOkvs, keys.size(), pp, seed);
+    mBinRows = mOkvs.size() / mOkvs.mNumBins;
+    mOkvs.binInputs(keys, mBinned);
+}
+
+void BaxosBinDecoder::decodeBin(u64 bin, oc::MatrixView<const block> D, oc::MatrixView<block> vals)
+{
+    mOkvs.decodeBin<block>(bin, mBinned, vals, D);
+}
+
+// ====================== 多轮复用的 keys 状态 ======================
+
+struct OkvsKeySet::State
+{
+    std::function<void(const oc::Matrix<block>&, oc::Matrix<block>&, const RowsDone&)> encode;
+    std::function<void(oc::MatrixView<const block>, oc::Matrix<block>&)> decode;
+};
+
+namespace
+{
+    template<typename T>
+    struct PaxosKeys
+    {
+        Paxos<T> paxos;
+        oc::Matrix<T> rows;     // 只解码时的行；编码时使用 paxos 自己保存的行
+        vector<block> dense;
+        std::unique_ptr<OkvsRowCache> cache;    // 只解码且行缓存命中时，rows/dense 指向它
+    };
+
+    struct BaxosKeys
+    {
+        Baxos okvs;
+        Baxos::BinnedInputs binned;
+    };
+
+    struct BandKeys
+    {
+        BandOkvs okvs;
+    };
+}
+
+OkvsKeySet::OkvsKeySet() = default;
+OkvsKeySet::~OkvsKeySet() = default;
+
+bool OkvsKeySet::init(
+    int bits,
+    const vector<block>& keys,
+    const PaxosParam& pp,
+    u64 seed,
+    OkvsEngine engine,
+    bool forEncode,
+    const string& rowCacheDir)
+{
+    mState.reset();
+    auto st = std::make_unique<State>();
+    u64 n = keys.size();
+
+    // Paxos 的 IdxType 由 bits 决定
+    auto initPaxos = [&](auto idx) {
+        using T = decltype(idx);
+        auto px = std::make_shared<PaxosKeys<T>>();
+        px->paxos.init(n, pp, block(seed, seed));
+        mRows = pp.size();
+
+        MatrixView<const T> rows;
+        span<const block> dense;
+        if (forEncode) {
+            setInputCached(px->paxos, keys, pp, seed, rowCacheDir);
+            px->paxos.prepare();
+            rows = MatrixView<const T>(px->paxos.mRows.data(), n, pp.mWeight);
+            dense = px->paxos.mDense;
+            st->encode = [px](const oc::Matrix<block>& vals, oc::Matrix<block>& D, const RowsDone& done) {
+                px->paxos.template encodePrepared<block>(vals, D);
+                if (done)
+                    done(0, D.rows());
+            };
+        } else {
+            // 行缓存命中时直接使用映射的 rows/dense，否则现算（并写入缓存）
+            px->cache = std::make_unique<OkvsRowCache>(rowCacheDir, keys, seed, pp, sizeof(T));
+            if (px->cache->enabled() && px->cache->load()) {
+                cout << "[rowCache] hit " << px->cache->path() << endl;
+                rows = px->cache->template rows<T>();
+                dense = px->cache->dense();
+            } else {
+                px->rows.resize(n, pp.mWeight);
+                px->dense.resize(n);
+                px->paxos.hashBuildRows(keys, px->rows, px->dense);
+                if (px->cache->enabled() &&
+                    px->cache->store(px->rows.data(), px->rows.size() * sizeof(T), px->dense))
+                    cout << "[rowCache] stored " << px->cache->path() << endl;
+                rows = MatrixView<const T>(px->rows.data(), n, pp.mWeight);
+                dense = px->dense;
+            }
+        }
+        st->decode = [px, rows, dense](oc::MatrixView<const block> D, oc::Matrix<block>& vals) {
+            px->paxos.template decodeRows<block>(rows, dense, vals, D);
+        };
+    };
+
+    Timer timer;
+    auto start = timer.setTimePoint("start");
+    try {
+        if (engine == OkvsEngine::Paxos) {
+            switch (bits) {
+            case 8:  initPaxos(u8());  break;
+            case 16: initPaxos(u16()); break;
+            case 32: initPaxos(u32()); break;
+            case 64: initPaxos(u64()); break;
+            default:
+                cerr << "Unsupported bit size: " << bits << endl;
+                return false;
+            }
+        } else if (engine == OkvsEngine::Baxos) {
+            auto bx = std::make_shared<BaxosKeys>();
+            initBaxos(bx->okvs, n, pp, seed);
+            bx->okvs.binInputs(keys, bx->binned);
+            mRows = bx->okvs.size();
+            st->encode = [bx](const oc::Matrix<block>& vals, oc::Matrix<block>& D, const RowsDone& done) {
+                bx->okvs.mBinDone = done;
+                bx->okvs.solveBinned<block>(bx->binned, vals, D, baxosThreads());
+                bx->okvs.mBinDone = nullptr;
+            };
+            // 各 bin 互相独立，分给 baxosThreads() 个线程解码
+            st->decode = [bx](oc::MatrixView<const block> D, oc::Matrix<block>& vals) {
+                auto numThreads = std::min<u64>(baxosThreads(), bx->okvs.mNumBins);
+                auto routine = [&](u64 t) {
+                    for (u64 bin = t; bin < bx->okvs.mNumBins; bin += numThreads)
+                        bx->okvs.decodeBin<block>(bin, bx->binned, vals, D);
+                };
+                vector<std::thread> thrds(numThreads - 1);
+                for (u64 t = 0; t < thrds.size(); ++t)
+                    thrds[t] = std::thread(routine, t);
+                routine(thrds.size());
+                for (auto& th : thrds)
+                    th.join();
+            };
+        } else {
+            auto band = std::make_shared<BandKeys>();
+            band->okvs.init(n, bandWidthOf(engine), pp.mSsp, block(seed, seed));
+            mRows = band->okvs.size();
+            // 编码与解码都只用到每个 key 的起始列与 band
+            band->okvs.setInput(keys);
+            if (forEncode) {
+                st->encode = [band](const oc::Matrix<block>& vals, oc::Matrix<block>& D, const RowsDone& done) {
+                    band->okvs.encode<block>(vals, D);
+                    if (done)
+                        done(0, D.rows());
+                };
+            } else {
+                st->decode = [band](oc::MatrixView<const block> D, oc::Matrix<block>& vals) {
+                    band->okvs.decodePrepared<block>(vals, D);
+                };
+            }
+        }
+    } catch (const exception& e) {
+        cerr << "OkvsKeySet::init exception: " << e.what() << endl;
+        return false;
+    }
+    auto end = timer.setTimePoint("end");
+
+    double ms = chrono::duration_cast<chrono::microseconds>(end - start).count() / 1000.0;
+    cout << "[OkvsKeySet] prepared " << n << " keys for " << (forEncode ? "encoding" : "decoding")
+         << " in " << ms << " ms" << endl;
+    mNumKeys = n;
+    mState = std::move(st);
+    return true;
+}
+
+bool OkvsKeySet::encode(const oc::Matrix<block>& vals, oc::Matrix<block>& D, const RowsDone& rowsDone)
+{
+    if (!mState || !mState->encode) {
+        cerr << "OkvsKeySet::encode: not prepared for encoding" << endl;
+        return false;
+    }
+    if (vals.rows() != mNumKeys) {
+        cerr << "OkvsKeySet::encode: got " << vals.rows() << " values for " << mNumKeys << " keys" << endl;
+        return false;
+    }
+    if (D.rows() != mRows || D.cols() != vals.cols())
+        D.resize(mRows, vals.cols(), oc::AllocType::Uninitialized);
+
+    try {
+        Timer timer;
+        auto encode_start = timer.setTimePoint("encode_start");
+        mState->encode(vals, D, rowsDone);
+        auto encode_end = timer.setTimePoint("encode_end");
+
+        double ms = chrono::duration_cast<chrono::microseconds>(encode_end - encode_start).count() / 1000.0;
+        cout << "[OkvsKeySet] encode time: " << ms << " ms" << endl;
+        return true;
+    } catch (const exception& e) {
+        cerr << "OkvsKeySet::encode exception: " << e.what() << endl;
+        return false;
+    }
+}
+
+bool OkvsKeySet::decode(oc::MatrixView<const block> D, oc::Matrix<block>& vals)
+{
+    if (!mState || !mState->decode) {
+        cerr << "OkvsKeySet::decode: not prepared for decoding" << endl;
+        return false;
+    }
+    if (D.rows() != mRows) {
+        cerr << "OkvsKeySet::decode: D has " << D.rows() << " rows, expected " << mRows << endl;
+        return false;
+    }
+    if (vals.rows() != mNumKeys || vals.cols() != D.cols())
+        vals.resize(mNumKeys, D.cols(), oc::AllocType::Uninitialized);
+
+    try {
+        Timer timer;
+        auto decode_start = timer.setTimePoint("decode_start");
+        mState->decode(D, vals);
+        auto decode_end = timer.setTimePoint("decode_end");
+
+        double ms = chrono::duration_cast<chrono::microseconds>(decode_end - decode_start).count() / 1000.0;
+        cout << "[OkvsKeySet] decode time: " << ms << " ms" << endl;
+        return true;
+    } catch (const exception& e) {
+        cerr << "OkvsKeySet::decode exception: " << e.what() << endl;
+        return false;
+    }
+}
+
 // ====================== dispatch：对外真正调用的接口 ======================
 
+u64 okvsSize(OkvsEngine engine, u64 n, const PaxosParam& pp)
+{
+    if (engine == OkvsEngine::Paxos)
+        return pp.size();
+    if (engine == OkvsEngine::Baxos) {
+        Baxos okvs;
+        initBaxos(okvs, n, pp, 0);
+        return okvs.size();
+    }
+    return BandParam(n, bandWidthOf(engine), pp.mSsp).size();
+}
+
 bool encodeOKVS_dispatch(
     int bits,
     const std::vector<block>& keys,
     const oc::Matrix<block>& vals,
     oc::Matrix<block>& okvs_out,
     PaxosParam& pp,
-    osuCrypto::u64 seed)
+    osuCrypto::u64 seed,
+    OkvsEngine engine,
+    const std::string& rowCacheDir)
 {
+    // Baxos 和 RB-OKVS 不需要 IdxType，bits 被忽略；行缓存只用于 Paxos
+    if (engine == OkvsEngine::Baxos)
+        return encodeBaxosOKVS_impl(keys, vals, okvs_out, pp, seed);
+    if (engine != OkvsEngine::Paxos)
+        return encodeBandOKVS_impl(keys, vals, okvs_out, pp, seed, engine);
+
     switch (bits) {
-    case 8:  return encodeOKVS_impl<u8 >(keys, vals, okvs_out, pp, seed);
-    case 16: return encodeOKVS_impl<u16>(keys, vals, okvs_out, pp, seed);
-    case 32: return encodeOKVS_impl<u32>(keys, vals, okvs_out, pp, seed);
-    case 64: return encodeOKVS_impl<u64>(keys, vals, okvs_out, pp, seed);
+    case 8:  return encodeOKVS_impl<u8 >(keys, vals, okvs_out, pp, seed, rowCacheDir);
+    case 16: return encodeOKVS_impl<u16>(keys, vals, okvs_out, pp, seed, rowCacheDir);
+    case 32: return encodeOKVS_impl<u32>(keys, vals, okvs_out, pp, seed, rowCacheDir);
+    case 64: return encodeOKVS_impl<u64>(keys, vals, okvs_out, pp, seed, rowCacheDir);
     default:
         cerr << "Unsupported bit size: " << bits << endl;
         return false;
     }
 }
 
+bool encodeOKVS_streamed(
+    int bits,
+    const std::vector<block>& keys,
+    const oc::Matrix<block>& vals,
+    oc::Matrix<block>& okvs_out,
+    PaxosParam& pp,
+    const std::function<void(u64, u64)>& rowsDone,
+    osuCrypto::u64 seed,
+    OkvsEngine engine,
+    const std::string& rowCacheDir)
+{
+    okvs_out.resize(okvsSize(engine, keys.size(), pp), vals.cols(), oc::AllocType::Uninitialized);
+
+    if (engine == OkvsEngine::Baxos)
+        return encodeBaxosOKVS_impl(keys, vals, okvs_out, pp, seed, rowsDone);
+
+    if (!encodeOKVS_dispatch(bits, keys, vals, okvs_out, pp, seed, engine, rowCacheDir))
+        return false;
+    rowsDone(0, okvs_out.rows());
+    return true;
+}
+
 bool decodeOKVS_dispatch(
     int bits,
     const std::vector<block>& keys,
-    const oc::Matrix<block>& okvs_in,
+    oc::MatrixView<const block> okvs_in,
     oc::Matrix<block>& vals_out,
     PaxosParam& pp,
-    osuCrypto::u64 seed)
+    osuCrypto::u64 seed,
+    OkvsEngine engine,
+    const std::string& rowCacheDir)
 {
+    if (engine == OkvsEngine::Baxos)
+        return decodeBaxosOKVS_impl(keys, okvs_in, vals_out, pp, seed);
+    if (engine != OkvsEngine::Paxos)
+        return decodeBandOKVS_impl(keys, okvs_in, vals_out, pp, seed, engine);
+
     switch (bits) {
-    case 8:  return decodeOKVS_impl<u8 >(keys, okvs_in, vals_out, pp, seed);
-    case 16: return decodeOKVS_impl<u16>(keys, okvs_in, vals_out, pp, seed);
-    case 32: return decodeOKVS_impl<u32>(keys, okvs_in, vals_out, pp, seed);
-    case 64: return decodeOKVS_impl<u64>(keys, okvs_in, vals_out, pp, seed);
+    case 8:  return decodeOKVS_impl<u8 >(keys, okvs_in, vals_out, pp, seed, rowCacheDir);
+    case 16: return decodeOKVS_impl<u16>(keys, okvs_in, vals_out, pp, seed, rowCacheDir);
+    case 32: return decodeOKVS_impl<u32>(keys, okvs_in, vals_out, pp, seed, rowCacheDir);
+    case 64: return decodeOKVS_impl<u64>(keys, okvs_in, vals_out, pp, seed, rowCacheDir);
     default:
         cerr << "Unsupported bit size: " << bits << endl;
         return false;
     }
-}
\ No newline at end of file
+}
+
+bool okvsFileCurrent(const OkvsFile& file)
+{
+    auto& h = file.header();
+    if (h.engine > static_cast<uint64_t>(OkvsEngine::Band512))
+        return false;
+
+    auto engine = static_cast<OkvsEngine>(h.engine);
+    auto pp = file.paxosParam();
+    auto expect = fileParamsOf(engine, h.numItems, pp);
+    auto got = file.params();
+    return got.bandWidth == expect.bandWidth &&
+        got.bandEpsilon == expect.bandEpsilon &&
+        got.baxosBinSize == expect.baxosBinSize &&
+        h.rows == okvsSize(engine, h.numItems, pp);
+}
+
+bool okvsFileMatches(
+    const OkvsFile& file,
+    const vector<block>& keys,
+    int bits,
+    const PaxosParam& pp,
+    u64 seed,
+    OkvsEngine engine)
+{
+    auto& h = file.header();
+    auto fp = file.paxosParam();
+    uint64_t idxBits = engine == OkvsEngine::Paxos ? bits : 0;
+    return okvsFileCurrent(file) &&
+        h.engine == static_cast<uint64_t>(engine) &&
+        h.seed == seed &&
+        h.bits == idxBits &&
+        h.numItems == keys.size() &&
+        fp.mWeight == pp.mWeight &&
+        fp.mSparseSize == pp.mSparseSize &&
+        fp.mDenseSize == pp.mDenseSize &&
+        fp.mSsp == pp.mSsp &&
+        fp.mDt == pp.mDt &&
+        fp.mHashMode == pp.mHashMode &&
+        h.keysDigest == OkvsRowCache::keysDigest(keys);
+}
+
+bool decodeOKVSFromFile(
+    const OkvsFile& file,
+    const std::vector<block>& keys,
+    oc::Matrix<block>& vals_out,
+    const std::string& rowCacheDir)
+{
+    if (!file.isOpen()) {
+        cerr << "decodeOKVSFromFile: file is not open" << endl;
+        return false;
+    }
+
+    auto& h = file.header();
+    if (h.numItems != keys.size()) {
+        cerr << "decodeOKVSFromFile: file was encoded for " << h.numItems
+             << " keys, got " << keys.size() << endl;
+        return false;
+    }
+    if (!okvsFileCurrent(file)) {
+        cerr << "decodeOKVSFromFile: unknown engine or stale engine parameters, re-encode the file" << endl;
+        return false;
+    }
+
+    PaxosParam pp = file.paxosParam();
+    return decodeOKVS_dispatch(int(h.bits), keys, file.matrix(), vals_out, pp, h.seed,
+        static_cast<OkvsEngine>(h.engine), rowCacheDir);
+}
+
+bool encodeOKVSToFile(
+    int bits,
+    const std::vector<block>& keys,
+    const oc::Matrix<block>& vals,
+    oc::Matrix<block>& okvs_out,
+    PaxosParam& pp,
+    const std::string& path,
+    u64 seed,
+    OkvsEngine engine)
+{
+    Timer timer;
+    auto start = timer.setTimePoint("start");
+
+    // 非 Baxos 引擎先编码；之后 okvs_out 不再变化，writer 才能引用它
+    if (engine != OkvsEngine::Baxos &&
+        !encodeOKVS_dispatch(bits, keys, vals, okvs_out, pp, seed, engine))
+        return false;
+    if (engine == OkvsEngine::Baxos)
+        okvs_out.resize(okvsSize(engine, keys.size(), pp), vals.cols());
+
+    uint64_t idxBits = engine == OkvsEngine::Paxos ? bits : 0;
+    OkvsFileWriter writer(path, okvs_out, static_cast<uint64_t>(engine), idxBits, seed, keys.size(), pp,
+        fileParamsOf(engine, keys.size(), pp, &keys));
+    if (!writer.ok())
+        return false;
+
+    if (engine == OkvsEngine::Baxos) {
+        if (!encodeBaxosOKVS_impl(keys, vals, okvs_out, pp, seed,
+                [&writer](u64 begin, u64 end) { writer.submit(begin, end); }))
+            return false;
+    } else {
+        writer.submit(0, okvs_out.rows());
+    }
+    auto encoded = timer.setTimePoint("encoded");
+    bool ok = writer.finish();
+    auto end = timer.setTimePoint("written");
+
+    auto ms = [](auto a, auto b) { return chrono::duration_cast<chrono::microseconds>(b - a).count() / 1000.0; };
+    cout << "[encodeOKVSToFile] encode " << ms(start, encoded) << " ms, write tail + fsync "
+         << ms(encoded, end) << " ms -> " << path << endl;
+    return ok;
+}
@@ -3,28 +3,82 @@
 
 #include <vector>
 #include <string>
+#include <future>
+#include <functional>
+#include <memory>
 #include <libOTe/Tools/LDPC/Mtx.h>
 #include <cryptoTools/Common/Defines.h>
 #include "Paxos.h"
+#include "ValuePrf.h"
+#include "OkvsFile.h"
 
 using osuCrypto::block;
 
+// OKVS 引擎选择
+enum class OkvsEngine
+{
+    Paxos,      // 3-weight Paxos，D 约 1.23n
+    Band64,     // 64 位随机带宽 OKVS (RB-OKVS)，ssp=40 时 D 约 1.45n
+    Band128,    // 128 位随机带宽 OKVS (RB-OKVS)，D 约 1.2n
+    Baxos,      // 把 key 分到 2^14 大小的 bin 中，各 bin 的 Paxos 多线程并行求解
+    Band256,    // 256 位随机带宽 OKVS，行运算用 AVX2，D 约 1.1n
+    Band512     // 512 位随机带宽 OKVS，行运算用 AVX-512，D 约 1.04n
+};
+
 // 声明你需要在 p1.cpp 里用的函数
 
+// 读取 keys.csv（每行一个十进制 u64）。文件被 mmap 后按行切成 numThreads 段并行解析，
+// 直接写入 keys。支持 CRLF，空行跳过，格式错误的行会被跳过并报告。numThreads = 0 表示自动。
+bool loadKeysFromCsv(
+    std::vector<block>& keys,
+    const std::string& keyPath,
+    size_t numThreads = 0);
+
+// 根据 keys 在内存中生成确定性的 values，vals 为 n x 1。
+// 所有参与方必须使用同一个 prf；ValuePrf::Sha256 与旧版本生成的 values 一致。
+// round 非 0 时混入密钥，常驻服务每一轮由轮次号得到一组新的 values。
+void generateValues(
+    const std::vector<block>& keys,
+    oc::Matrix<block>& vals,
+    ValuePrf prf = ValuePrf::Aes,
+    size_t numThreads = 0,
+    osuCrypto::u64 round = 0);
+
+// 读取 keys 并生成 values。valPath 非空时会在后台把 values 以二进制格式
+// （同 saveMatrixToFile）写出：给了 valSaved 就把 future 交给调用者，
+// 否则在返回前等待写完。调用者需保证 vals 在写完之前有效。
+// 只需要 keys 的接收方请直接用 loadKeysFromCsv。
 bool loadKeysAndGenerateValues(
     std::vector<block>& keys,
     oc::Matrix<block>& vals,
     const std::string& keyPath,
-    const std::string& valPath);
+    const std::string& valPath = "",
+    std::future<bool>* valSaved = nullptr);
 
 bool saveMatrixToFile(
     const oc::Matrix<block>& M,
     const std::string& path);
 
+// 在后台线程中执行 saveMatrixToFile
+std::future<bool> saveMatrixToFileAsync(
+    const oc::Matrix<block>& M,
+    const std::string& path);
+
 bool loadMatrixFromFile(
     oc::Matrix<block>& M,
     const std::string& path);
 
+// 以 OkvsFile 格式（4 KiB 对齐的自描述头 + 校验和）写出 OKVS 矩阵 D，
+// 参数与 encodeOKVS_dispatch 的调用参数一致。头部记录 keys 的摘要
+bool saveOKVSToFile(
+    const oc::Matrix<block>& D,
+    const std::string& path,
+    int bits,
+    const std::vector<block>& keys,
+    const volePSI::PaxosParam& pp,
+    osuCrypto::u64 seed = 0,
+    OkvsEngine engine = OkvsEngine::Paxos);
+
 // OKVS 编码/解码对外接口
 bool encodeOKVS_dispatch(
     int bits,
@@ -32,12 +86,144 @@ bool encodeOKVS_dispatch(
     const oc::Matrix<block>& vals,
     oc::Matrix<block>& okvs_out,
     volePSI::PaxosParam& pp,        // ★ 加上 volePSI::
-    osuCrypto::u64 seed = 0);
+    osuCrypto::u64 seed = 0,
+    OkvsEngine engine = OkvsEngine::Paxos,
+    const std::string& rowCacheDir = "");   // 哈希行缓存目录，空表示不使用
 
 bool decodeOKVS_dispatch(
     int bits,
     const std::vector<block>& keys,
-    const oc::Matrix<block>& okvs_in,
+    oc::MatrixView<const block> okvs_in,
     oc::Matrix<block>& vals_out,
     volePSI::PaxosParam& pp,        // ★ 同样
-    osuCrypto::u64 seed = 0);
\ No newline at end of file
+    osuCrypto::u64 seed = 0,
+    OkvsEngine engine = OkvsEngine::Paxos,
+    const std::string& rowCacheDir = "");   // 哈希行缓存目录，空表示不使用
+
+// 与 encodeOKVS_dispatch 相同，但 D 的 [begin, end) 行确定后即调用 rowsDone(begin, end)。
+// okvs_out 在编码前就按 okvsSize 分配好，调用方可以在编码过程中读取已完成的行。
+// Baxos 每个 bin 解出后调用一次（来自多个求解线程，大致按行号递增），
+// 其他引擎在编码完成后以 [0, rows) 调用一次。
+bool encodeOKVS_streamed(
+    int bits,
+    const std::vector<block>& keys,
+    const oc::Matrix<block>& vals,
+    oc::Matrix<block>& okvs_out,
+    volePSI::PaxosParam& pp,
+    const std::function<void(osuCrypto::u64, osuCrypto::u64)>& rowsDone,
+    osuCrypto::u64 seed = 0,
+    OkvsEngine engine = OkvsEngine::Paxos,
+    const std::string& rowCacheDir = "");
+
+// Baxos 引擎下按 bin 解码：init 时把 keys 哈希并按 bin 分组，之后 D 中某个 bin
+// 的行一到齐就可以用 decodeBin 解出该 bin 内的 keys，不等整个 D。不同 bin
+// 可以在多个线程中并行解码。参数与 encodeOKVS_dispatch 的调用参数一致。
+class BaxosBinDecoder
+{
+public:
+    void init(const std::vector<block>& keys, const volePSI::PaxosParam& pp, osuCrypto::u64 seed);
+
+    osuCrypto::u64 numBins() const { return mOkvs.mNumBins; }
+
+    // 每个 bin 在 D 中占的行数，bin i 为 [i * binRows, (i + 1) * binRows)
+    osuCrypto::u64 binRows() const { return mBinRows; }
+
+    // D 的总行数
+    osuCrypto::u64 rows() const { return mBinRows * mOkvs.mNumBins; }
+
+    // 解码 bin 内的 keys，写到 vals 的对应行（vals 为 keys.size() x D.cols()）。
+    // 只读取 D 中该 bin 的行。出错时抛异常。
+    void decodeBin(osuCrypto::u64 bin, oc::MatrixView<const block> D, oc::MatrixView<block> vals);
+
+private:
+    volePSI::Baxos mOkvs;
+    volePSI::Baxos::BinnedInputs mBinned;
+    osuCrypto::u64 mBinRows = 0;
+};
+
+// 一组固定 keys 的 OKVS 状态，供常驻服务在多轮之间复用。init 时做完与 values
+// 无关的全部工作：AES 哈希与建行、Paxos 的三角化（Paxos::prepare）、Baxos 的
+// 分 bin（Baxos::binInputs）、RB-OKVS 的 setInput。之后每一轮的 encode 只剩
+// 回代，decode 直接使用保存的行。forEncode 为 false 时只准备 decode 需要的部分。
+// init 不依赖 D，接收方可以在等待连接与接收 D 的同时在后台调用它。
+class OkvsKeySet
+{
+public:
+    using RowsDone = std::function<void(osuCrypto::u64, osuCrypto::u64)>;
+
+    OkvsKeySet();
+    ~OkvsKeySet();
+
+    OkvsKeySet(const OkvsKeySet&) = delete;
+    OkvsKeySet& operator=(const OkvsKeySet&) = delete;
+
+    // 参数与 encodeOKVS_dispatch 的调用参数一致；Paxos 的行缓存同样可用
+    bool init(
+        int bits,
+        const std::vector<block>& keys,
+        const volePSI::PaxosParam& pp,
+        osuCrypto::u64 seed,
+        OkvsEngine engine,
+        bool forEncode,
+        const std::string& rowCacheDir = "");
+
+    osuCrypto::u64 numKeys() const { return mNumKeys; }
+
+    // D 的行数
+    osuCrypto::u64 rows() const { return mRows; }
+
+    // 用 init 时的 keys 编码 vals。D 的形状不变时沿用其内存。
+    // rowsDone 同 encodeOKVS_streamed，可以为空
+    bool encode(const oc::Matrix<block>& vals, oc::Matrix<block>& D, const RowsDone& rowsDone = nullptr);
+
+    bool decode(oc::MatrixView<const block> D, oc::Matrix<block>& vals);
+
+private:
+    struct State;
+    std::unique_ptr<State> mState;
+    osuCrypto::u64 mNumKeys = 0;
+    osuCrypto::u64 mRows = 0;
+};
+
+// 给定引擎下 n 个 key 的 D 行数
+osuCrypto::u64 okvsSize(
+    OkvsEngine engine,
+    osuCrypto::u64 n,
+    const volePSI::PaxosParam& pp);
+
+// 编码并把 D 写成 OkvsFile（OkvsFileWriter：分块并行 pwrite/O_DIRECT，只 fsync 一次）。
+// Baxos 引擎下每个 bin 解出后立刻提交写出，与后续 bin 的求解重叠；
+// 其他引擎在编码完成后写出。okvs_out 同时保留在内存中。
+bool encodeOKVSToFile(
+    int bits,
+    const std::vector<block>& keys,
+    const oc::Matrix<block>& vals,
+    oc::Matrix<block>& okvs_out,
+    volePSI::PaxosParam& pp,
+    const std::string& path,
+    osuCrypto::u64 seed = 0,
+    OkvsEngine engine = OkvsEngine::Paxos);
+
+// 文件头中的引擎和引擎参数（RB-OKVS 的带宽和 eps、Baxos 的 bin 大小）以及 D 的行数
+// 是否与当前代码由 numItems、PaxosParam 推出的一致。
+// 不一致说明文件由旧版本写出（例如 RB-OKVS 的 eps 变了），需要重新编码
+bool okvsFileCurrent(const OkvsFile& file);
+
+// file 是否正是由这些输入编码得到的：keys 的摘要、seed、引擎、IdxType 位宽、
+// PaxosParam（含 hash mode）都与头部一致，且 okvsFileCurrent。
+// 不一致时 D 与当前输入无关，必须重新编码
+bool okvsFileMatches(
+    const OkvsFile& file,
+    const std::vector<block>& keys,
+    int bits,
+    const volePSI::PaxosParam& pp,
+    osuCrypto::u64 seed,
+    OkvsEngine engine);
+
+// 直接从 mmap 的 OkvsFile 解码：引擎、IdxType、PaxosParam、seed 全部取自文件头，
+// D 不做拷贝。keys 个数须与文件头中的 numItems 一致。
+bool decodeOKVSFromFile(
+    const OkvsFile& file,
+    const std::vector<block>& keys,
+    oc::Matrix<block>& vals_out,
+    const std::string& rowCacheDir = "");
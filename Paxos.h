@@ -7,6 +7,7 @@
 #include <numeric>
 #include <iomanip>
 #include <cmath>
+#include <functional>
 
 #include "Defines.h"
 
@@ -36,17 +37,20 @@ namespace volePSI
 			mSsp = 40;
 		DenseType mDt = GF128;
 
+		// how hashes are reduced to column indices.
+		PaxosHashMode mHashMode = PaxosHashMode::LibDivide;
+
 		PaxosParam() = default;
 		PaxosParam(const PaxosParam&) = default;
 		PaxosParam& operator=(const PaxosParam&) = default;
 
-		PaxosParam(u64 numItems, u64 weight = 3, u64 ssp = 40, DenseType dt = DenseType::GF128)
+		PaxosParam(u64 numItems, u64 weight = 3, u64 ssp = 40, DenseType dt = DenseType::GF128, PaxosHashMode mode = PaxosHashMode::LibDivide)
 		{
-			init(numItems, weight, ssp, dt);
+			init(numItems, weight, ssp, dt, mode);
 		}
 
 		// computes the paxos parameters based the parameters.
-		void init(u64 numItems, u64 weight = 3, u64 ssp = 40, DenseType dt = DenseType::GF128);
+		void init(u64 numItems, u64 weight = 3, u64 ssp = 40, DenseType dt = DenseType::GF128, PaxosHashMode mode = PaxosHashMode::LibDivide);
 
 		// the size of the paxos data structure.
 		u64 size() const
@@ -99,6 +103,11 @@ namespace volePSI
 		// A data structure used to track the current weight of the rows.s
 		WeightData<IdxType> mWeightSets;
 
+		// the triangulation computed by prepare().
+		std::vector<IdxType> mMainRows, mMainCols;
+		std::vector<std::array<IdxType, 2>> mGapRows;
+		bool mPrepared = false;
+
 		Paxos() = default;
 		Paxos(const Paxos&) = default;
 		Paxos(Paxos&&) = default;
@@ -203,6 +212,43 @@ namespace volePSI
 		template<typename Vec, typename ConstVec, typename Helper>
 		void encode(ConstVec& values, Vec& output, Helper& h, oc::PRNG* prng = nullptr);
 
+		// triangulate the input given to setInput() once and keep the result,
+		// so that encodePrepared() can encode any number of value vectors for
+		// the same inputs with only the backfill step.
+		void prepare();
+
+		// encode values for the prepared input. Unlike encode(), this does not
+		// consume the triangulation and can be called repeatedly. values should
+		// have numItems rows, output should have size() rows and both the same
+		// number of columns.
+		template<typename ValueType>
+		void encodePrepared(MatrixView<const ValueType> values, MatrixView<ValueType> output)
+		{
+			if (values.cols() != output.cols())
+				throw RTE_LOC;
+
+			if (values.cols() == 1)
+			{
+				span<const ValueType> v(values);
+				span<ValueType> o(output);
+				PxVector<const ValueType> V(v);
+				PxVector<ValueType> P(o);
+				auto h = P.defaultHelper();
+				encodePrepared(V, P, h);
+			}
+			else
+			{
+				PxMatrix<const ValueType> V(values);
+				PxMatrix<ValueType> P(output);
+				auto h = P.defaultHelper();
+				encodePrepared(V, P, h);
+			}
+		}
+
+		// encodePrepared with the given PxVector/PxMatrix and helper.
+		template<typename Vec, typename ConstVec, typename Helper>
+		void encodePrepared(ConstVec& values, Vec& output, Helper& h);
+
 		// Decode the given input based on the data paxos structure p. The
 		// output is written to values.
 		template<typename ValueType>
@@ -220,6 +266,20 @@ namespace volePSI
 		template<typename Helper, typename Vec, typename ConstVec>
 		void decode(span<const block> input, Vec& values, ConstVec& p, Helper& h);
 
+		// Decode with row indices and dense values that were computed ahead of
+		// time, e.g. by hashBuildRows or loaded from a row cache. rows should 
+		// have mWeight columns, rows, dense and values should have the same size.
+		template<typename ValueType>
+		void decodeRows(MatrixView<const IdxType> rows, span<const block> dense, MatrixView<ValueType> values, MatrixView<const ValueType> p);
+
+		// decodeRows with the given PxVector/PxMatrix and helper.
+		template<typename Helper, typename Vec, typename ConstVec>
+		void decodeRows(MatrixView<const IdxType> rows, span<const block> dense, Vec& values, ConstVec& p, Helper& h);
+
+		// compute the row indices and dense values of the inputs without
+		// setting them as the input. rows should have mWeight columns.
+		void hashBuildRows(span<const block> inputs, MatrixView<IdxType> rows, span<block> dense);
+
 
 		struct Triangulization
 		{
@@ -271,7 +331,7 @@ namespace volePSI
 			Helper& h);
 
 		// manually set the row indicies and the dense values.
-		void setInput(MatrixView<IdxType> rows, span<block> dense);
+		void setInput(MatrixView<const IdxType> rows, span<const block> dense);
 
 		// manually set the row indicies and the dense values. In 
 		// addition, provide the memory that us needed to to perform
@@ -425,8 +485,13 @@ namespace volePSI
 		// output, as opposed to overwriting.
 		bool mAddToDecode = false;
 
+		// if set, called by the solving thread as soon as a bin has been
+		// solved, with the output rows [begin, end) that are now final.
+		// Allows the output to be consumed while later bins are still solved.
+		std::function<void(u64 begin, u64 end)> mBinDone;
+
 		// initialize the paxos with the given parameter.
-		void init(u64 numItems, u64 binSize, u64 weight, u64 ssp, PaxosParam::DenseType dt, block seed)
+		void init(u64 numItems, u64 binSize, u64 weight, u64 ssp, PaxosParam::DenseType dt, block seed, PaxosHashMode mode = PaxosHashMode::LibDivide)
 		{
 			mNumItems = numItems;
 			mWeight = weight;
@@ -434,7 +499,7 @@ namespace volePSI
 			mItemsPerBin = getBinSize(mNumBins, mNumItems, ssp + std::log2(mNumBins));
 			mSsp = ssp;
 			mSeed = seed;
-			mPaxosParam.init(mItemsPerBin, weight, ssp, dt);
+			mPaxosParam.init(mItemsPerBin, weight, ssp, dt, mode);
 		}
 
 		// solve the system for the given input vectors.
@@ -516,6 +581,38 @@ namespace volePSI
 
 
 
+		// the inputs hashed and grouped by bin, see binInputs().
+		struct BinnedInputs
+		{
+			// the hashes of the inputs, grouped by bin.
+			std::vector<block> mHashes;
+
+			// the input index of each hash.
+			std::vector<u64> mInIdxs;
+
+			// bin i holds the hashes [mBinBegin[i], mBinBegin[i+1]).
+			std::vector<u64> mBinBegin;
+		};
+
+		// hash the inputs and group them by bin. Each bin can then be
+		// decoded on its own with decodeBin(), e.g. as soon as that bin's
+		// slice of the paxos has been received.
+		void binInputs(span<const block> inputs, BinnedInputs& binned);
+
+		// solve the system for inputs that binInputs() already hashed and
+		// grouped, skipping the hashing and binning that solve() repeats on
+		// every call. values are indexed like the original inputs. mBinDone
+		// is called as in solve().
+		template<typename ValueType>
+		void solveBinned(BinnedInputs& binned, MatrixView<const ValueType> values, MatrixView<ValueType> output, u64 numThreads = 0);
+
+		// decode the inputs that binInputs() placed in bin binIdx. Only the rows
+		// [binIdx, binIdx + 1) * size() / mNumBins of p are read, and only the
+		// rows of values that belong to inputs of this bin are written.
+		// Different bins can be decoded concurrently.
+		template<typename ValueType>
+		void decodeBin(u64 binIdx, BinnedInputs& binned, MatrixView<ValueType> values, MatrixView<const ValueType> p);
+
 		// solve/encode the system.
 		template<typename IdxType, typename Vec, typename ConstVec, typename Helper>
 		void implParSolve(
@@ -526,6 +623,15 @@ namespace volePSI
 			u64 numThreads,
 			Helper& h);
 
+		// solve the pre-binned system, see solveBinned().
+		template<typename IdxType, typename Vec, typename ConstVec, typename Helper>
+		void implSolveBinned(
+			BinnedInputs& binned,
+			ConstVec& values,
+			Vec& output,
+			u64 numThreads,
+			Helper& h);
+
 		// create the desired number of threads and split up the work.
 		template<typename IdxType, typename Vec, typename ConstVec, typename Helper>
 		void implParDecode(
@@ -540,6 +646,10 @@ namespace volePSI
 		template<typename IdxType, typename Vec, typename ConstVec, typename Helper>
 		void implDecodeBatch(span<const block> inputs, Vec& values, ConstVec& p, Helper& h);
 
+		// decode the inputs of a single bin that were grouped by binInputs().
+		template<typename IdxType, typename Vec, typename ConstVec, typename Helper>
+		void implDecodeBinned(u64 binIdx, BinnedInputs& binned, Vec& values, ConstVec& p, Helper& h);
+
 		// decode the given inputs based on the paxos p. The output is written to values.
 		// this differs from implDecode in that all inputs must be for the same paxos bin.
 		template<typename IdxType, typename Vec, typename ConstVec, typename Helper>
@@ -563,14 +673,25 @@ namespace volePSI
 
 		u64 binIdxCompress(const block& h)
 		{
+			// fast range takes the bin from the top bits, and the in-bin columns
+			// are taken from the top of the 8 byte windows at bytes 4, 8 and 12.
+			// Mixing those bytes into the bin index would make the columns of
+			// keys in the same bin correlated, so only bytes [0,4) are used.
+			if (mPaxosParam.mHashMode == PaxosHashMode::FastRange)
+				return h.get<u64>(0) << 32;
 			return (h.get<u64>(0) ^ h.get<u64>(1) ^ h.get<u32>(3));
 		}
 
 		u64 modNumBins(const block& h)
 		{
+			if (mPaxosParam.mHashMode == PaxosHashMode::FastRange)
+				return fastRange(binIdxCompress(h), mNumBins);
 			return binIdxCompress(h) % mNumBins;
 		}
 
+		// reduce 32 compressed hashes to their bin index in place.
+		void modNumBins32(u64* binIdxs, const libdivide::libdivide_u64_t& divider);
+
 
 		template<typename Vec, typename Vec2>
 		void check(span<const block> inputs, Vec values, Vec2 output)
@@ -150,7 +150,7 @@ namespace volePSI
 
 
 	// See paper https://eprint.iacr.org/2022/320.pdf
-	inline void  PaxosParam::init(u64 numItems, u64 weight, u64 ssp, DenseType dt)
+	inline void  PaxosParam::init(u64 numItems, u64 weight, u64 ssp, DenseType dt, PaxosHashMode mode)
 	{
 		if (weight < 2)
 			throw std::runtime_error("weight must be 2 or greater.");
@@ -158,6 +158,7 @@ namespace volePSI
 		mWeight = weight;
 		mSsp = ssp;
 		mDt = dt;
+		mHashMode = mode;
 
 		double logN = std::log2(numItems);
 
@@ -299,6 +300,24 @@ namespace volePSI
 		}
 	}
 
+	// vals[i] = fastRange(vals[i], modVal) for i in [0,32). There is no 64 bit 
+	// multiply-high in AVX2/AVX-512F, so this relies on the scalar mulx, 
+	// which has a throughput of one per cycle.
+	inline void doFastRange32(u64* vals, const u64& modVal)
+	{
+		for (u64 i = 0; i < 32; i += 8)
+		{
+			vals[i + 0] = fastRange(vals[i + 0], modVal);
+			vals[i + 1] = fastRange(vals[i + 1], modVal);
+			vals[i + 2] = fastRange(vals[i + 2], modVal);
+			vals[i + 3] = fastRange(vals[i + 3], modVal);
+			vals[i + 4] = fastRange(vals[i + 4], modVal);
+			vals[i + 5] = fastRange(vals[i + 5], modVal);
+			vals[i + 6] = fastRange(vals[i + 6], modVal);
+			vals[i + 7] = fastRange(vals[i + 7], modVal);
+		}
+	}
+
 	//inline void doMod32(u64* vals, const libdivide::libdivide_u64_branchfree_t* divider, const u64& modVal)
 	//{
 	//	//std::array<u64, 4> temp64;
@@ -318,8 +337,14 @@ namespace volePSI
 	template<typename IdxType>
 	void PaxosHash<IdxType>::mod32(u64* vals, u64 modIdx) const
 	{
-		auto divider = &mMods[modIdx];
 		auto modVal = mModVals[modIdx];
+		if (mMode == PaxosHashMode::FastRange)
+		{
+			doFastRange32(vals, modVal);
+			return;
+		}
+
+		auto divider = &mMods[modIdx];
 		doMod32(vals, divider, modVal);
 	}
 
@@ -626,9 +651,9 @@ namespace volePSI
 			auto rr0 = *(u64*)(&rr[0]);
 			auto rr1 = *(u64*)(&rr[1]);
 			auto rr2 = *(u64*)(&rr[2]);
-			row[0] = (IdxType)(rr0 % mSparseSize);
-			row[1] = (IdxType)(rr1 % (mSparseSize - 1));
-			row[2] = (IdxType)(rr2 % (mSparseSize - 2));
+			row[0] = (IdxType)mod(rr0, 0);
+			row[1] = (IdxType)mod(rr1, 1);
+			row[2] = (IdxType)mod(rr2, 2);
 
 			assert(row[0] < mSparseSize);
 			assert(row[1] < mSparseSize);
@@ -654,11 +679,9 @@ namespace volePSI
 			auto hh = hash;
 			for (u64 j = 0; j < mWeight; ++j)
 			{
-				auto modulus = (mSparseSize - j);
-
 				hh = hh.gf128Mul(hh);
 				//std::memcpy(&h, (u8*)&hash + byteIdx, mIdxSize);
-				auto colIdx = hh.get<u64>(0) % modulus;
+				auto colIdx = mod(hh.get<u64>(0), j);
 
 				auto iter = row;
 				auto end = row + j;
@@ -768,7 +791,7 @@ namespace volePSI
 		static_cast<PaxosParam&>(*this) = p;
 		mNumItems = static_cast<IdxType>(numItems);
 		mSeed = seed;
-		mHasher.init(mSeed, mWeight, mSparseSize);
+		mHasher.init(mSeed, mWeight, mSparseSize, mHashMode);
 	}
 
 	template<typename IdxType>
@@ -779,6 +802,7 @@ namespace volePSI
 			throw RTE_LOC;
 
 		allocate();
+		mPrepared = false;
 
 		std::vector<IdxType> colWeights(mSparseSize);
 
@@ -839,7 +863,7 @@ namespace volePSI
 
 
 	template<typename IdxType>
-	void Paxos<IdxType>::setInput(MatrixView<IdxType> rows, span<block> dense)
+	void Paxos<IdxType>::setInput(MatrixView<const IdxType> rows, span<const block> dense)
 	{
 		if (rows.rows() != mNumItems || dense.size() != mNumItems)
 			throw RTE_LOC;
@@ -847,6 +871,7 @@ namespace volePSI
 			throw RTE_LOC;
 
 		allocate();
+		mPrepared = false;
 
 		std::vector<IdxType> colWeights(mSparseSize);
 
@@ -977,6 +1002,95 @@ namespace volePSI
 
 
 
+	template<typename IdxType>
+	void Paxos<IdxType>::hashBuildRows(span<const block> inputs, MatrixView<IdxType> rows, span<block> dense)
+	{
+		if (rows.rows() != inputs.size() || dense.size() != inputs.size())
+			throw RTE_LOC;
+		if (rows.cols() != mWeight)
+			throw RTE_LOC;
+
+		auto main = inputs.size() / gPaxosBuildRowSize * gPaxosBuildRowSize;
+		auto inIter = inputs.data();
+		for (u64 i = 0; i < main; i += gPaxosBuildRowSize, inIter += gPaxosBuildRowSize)
+		{
+			assert(gPaxosBuildRowSize == 32);
+			mHasher.hashBuildRow32(inIter, rows[i].data(), &dense[i]);
+		}
+
+		for (u64 i = main; i < inputs.size(); ++i, ++inIter)
+			mHasher.hashBuildRow1(inIter, rows[i].data(), &dense[i]);
+	}
+
+	template<typename IdxType>
+	template<typename ValueType>
+	void Paxos<IdxType>::decodeRows(MatrixView<const IdxType> rows, span<const block> dense, MatrixView<ValueType> values, MatrixView<const ValueType> p)
+	{
+		if (values.cols() != p.cols())
+			throw RTE_LOC;
+
+		if (values.cols() == 1)
+		{
+			span<ValueType> v(values);
+			span<const ValueType> pp(p);
+			PxVector<ValueType> VV(v);
+			PxVector<const ValueType> PP(pp);
+			auto h = PP.defaultHelper();
+			decodeRows(rows, dense, VV, PP, h);
+		}
+		else
+		{
+			PxMatrix<ValueType> VV(values);
+			PxMatrix<const ValueType> PP(p);
+			auto h = PP.defaultHelper();
+			decodeRows(rows, dense, VV, PP, h);
+		}
+	}
+
+	template<typename IdxType>
+	template<typename Helper, typename Vec, typename ConstVec>
+	void Paxos<IdxType>::decodeRows(MatrixView<const IdxType> rows, span<const block> dense, Vec& values, ConstVec& PP, Helper& h)
+	{
+		setTimePoint("decodeRows begin");
+
+		if (PP.size() != size())
+			throw RTE_LOC;
+		if (rows.rows() != dense.size() || values.size() != dense.size())
+			throw RTE_LOC;
+		if (rows.cols() != mWeight)
+			throw RTE_LOC;
+
+		auto main = dense.size() / gPaxosBuildRowSize * gPaxosBuildRowSize;
+
+		if (mAddToDecode)
+		{
+			auto v = h.newVec(gPaxosBuildRowSize);
+			for (u64 i = 0; i < main; i += gPaxosBuildRowSize)
+			{
+				assert(gPaxosBuildRowSize == 32);
+				decode32(rows[i].data(), &dense[i], v[0], PP, h);
+				for (u64 j = 0; j < 32; ++j)
+					h.add(values[i + j], v[j]);
+			}
+
+			for (u64 i = main; i < dense.size(); ++i)
+			{
+				decode1(rows[i].data(), &dense[i], v[0], PP, h);
+				h.add(values[i], v[0]);
+			}
+		}
+		else
+		{
+			for (u64 i = 0; i < main; i += gPaxosBuildRowSize)
+				decode32(rows[i].data(), &dense[i], values[i], PP, h);
+
+			for (u64 i = main; i < dense.size(); ++i)
+				decode1(rows[i].data(), &dense[i], values[i], PP, h);
+		}
+
+		setTimePoint("decodeRows done");
+	}
+
 	template<typename IdxType>
 	void Paxos<IdxType>::setInput(
 		MatrixView<IdxType> rows,
@@ -1000,6 +1114,7 @@ namespace volePSI
 		mDense = (dense);
 		mCols = cols;
 		mColBacking = colBacking;
+		mPrepared = false;
 
 		rebuildColumns(colWeights, mWeight * mNumItems);
 		mWeightSets.init(colWeights);
@@ -1209,6 +1324,32 @@ namespace volePSI
 		backfill(mainRows, mainCols, gapRows, values, output, h, prng);
 	}
 
+	template<typename IdxType>
+	void Paxos<IdxType>::prepare()
+	{
+		mMainRows.clear();
+		mMainCols.clear();
+		mGapRows.clear();
+		mMainRows.reserve(mNumItems);
+		mMainCols.reserve(mNumItems);
+
+		triangulate(mMainRows, mMainCols, mGapRows);
+		mPrepared = true;
+	}
+
+	template<typename IdxType>
+	template<typename Vec, typename ConstVec, typename Helper>
+	void Paxos<IdxType>::encodePrepared(ConstVec& values, Vec& output, Helper& h)
+	{
+		if (!mPrepared || static_cast<u64>(output.size()) != size())
+			throw RTE_LOC;
+
+		// backfill only reads the rows and the triangulation, 
+		// so the same triangulation serves every call.
+		output.zerofill();
+		backfill(mMainRows, mMainCols, mGapRows, values, output, h, nullptr);
+	}
+
 	template<typename IdxType>
 	template<typename Vec, typename ConstVec, typename Helper>
 	Vec Paxos<IdxType>::getX2Prime(
@@ -2555,6 +2696,14 @@ namespace volePSI
 		return SimpleIndex::get_bin_size(numBins, numBalls, statSecParam);
 	}
 
+	inline void Baxos::modNumBins32(u64* binIdxs, const libdivide::libdivide_u64_t& divider)
+	{
+		if (mPaxosParam.mHashMode == PaxosHashMode::FastRange)
+			doFastRange32(binIdxs, mNumBins);
+		else
+			doMod32(binIdxs, &divider, mNumBins);
+	}
+
 	template<typename ValueType>
 	void Baxos::solve(span<const block> inputs, span<const ValueType> values, span<ValueType> output, PRNG* prng, u64 numThreads)
 	{
@@ -2648,6 +2797,8 @@ namespace volePSI
 			paxos.init(mNumItems, mPaxosParam, mSeed);
 			paxos.setInput(inputs_);
 			paxos.encode(vals_, p_, h, prng);
+			if (mBinDone)
+				mBinDone(0, size());
 
 			//auto v2 = h.newVec(vals_.size());
 			//paxos.decode(inputs_, v2, p_, h);
@@ -2756,7 +2907,7 @@ namespace volePSI
 					for (u64 k = 0; k < batchSize; ++k)
 						binIdxs[k] = binIdxCompress(hashes[k]);
 
-					doMod32(binIdxs.data(), &divider, mNumBins);
+					modNumBins32(binIdxs.data(), divider);
 
 					for (u64 k = 0; k < batchSize; ++k, ++inIdx)
 					{
@@ -2917,6 +3068,8 @@ namespace volePSI
 
 				paxos.setInput(rows, hashes, cols, colBacking, colWeights);
 				paxos.encode(values, output, h, prng);
+				if (mBinDone)
+					mBinDone(paxosSizePer * binIdx, paxosSizePer * (binIdx + 1));
 
 			}
 		};
@@ -3103,7 +3256,7 @@ namespace volePSI
 				binIdxs[j + 7] = binIdxCompress(buffer[j + 7]);
 			}
 
-			doMod32(binIdxs.data(), &divider, mNumBins);
+			modNumBins32(binIdxs.data(), divider);
 
 			for (u64 k = 0; k < batchSize; ++k)
 			{
@@ -3202,4 +3355,201 @@ namespace volePSI
 	}
 
 
+
+	inline void Baxos::binInputs(span<const block> inputs, BinnedInputs& binned)
+	{
+		AES hasher(mSeed);
+		std::vector<block> hashes(inputs.size());
+		hasher.hashBlocks(inputs.data(), inputs.size(), hashes.data());
+
+		// counting sort of the inputs by bin index.
+		std::vector<u64> binIdxs(inputs.size());
+		binned.mBinBegin.assign(mNumBins + 1, 0);
+		for (u64 i = 0; i < inputs.size(); ++i)
+		{
+			binIdxs[i] = modNumBins(hashes[i]);
+			++binned.mBinBegin[binIdxs[i] + 1];
+		}
+		for (u64 i = 0; i < mNumBins; ++i)
+			binned.mBinBegin[i + 1] += binned.mBinBegin[i];
+
+		binned.mHashes.resize(inputs.size());
+		binned.mInIdxs.resize(inputs.size());
+		std::vector<u64> pos(binned.mBinBegin.begin(), binned.mBinBegin.end() - 1);
+		for (u64 i = 0; i < inputs.size(); ++i)
+		{
+			auto j = pos[binIdxs[i]]++;
+			binned.mHashes[j] = hashes[i];
+			binned.mInIdxs[j] = i;
+		}
+	}
+
+
+	template<typename ValueType>
+	void Baxos::solveBinned(BinnedInputs& binned, MatrixView<const ValueType> values, MatrixView<ValueType> output, u64 numThreads)
+	{
+		if (values.cols() != output.cols() || output.rows() != size() ||
+			values.rows() != binned.mHashes.size() ||
+			binned.mBinBegin.size() != mNumBins + 1)
+			throw RTE_LOC;
+
+		auto bitLength = oc::roundUpTo(oc::log2ceil((u64)(mPaxosParam.mSparseSize + 1)), 8);
+		auto run = [&](auto& V, auto& P)
+		{
+			auto h = P.defaultHelper();
+			if (bitLength <= 8)
+				implSolveBinned<u8>(binned, V, P, numThreads, h);
+			else if (bitLength <= 16)
+				implSolveBinned<u16>(binned, V, P, numThreads, h);
+			else if (bitLength <= 32)
+				implSolveBinned<u32>(binned, V, P, numThreads, h);
+			else
+				implSolveBinned<u64>(binned, V, P, numThreads, h);
+		};
+
+		if (values.cols() == 1)
+		{
+			span<const ValueType> v(values);
+			span<ValueType> o(output);
+			PxVector<const ValueType> V(v);
+			PxVector<ValueType> P(o);
+			run(V, P);
+		}
+		else
+		{
+			PxMatrix<const ValueType> V(values);
+			PxMatrix<ValueType> P(output);
+			run(V, P);
+		}
+	}
+
+	template<typename IdxType, typename Vec, typename ConstVec, typename Helper>
+	void Baxos::implSolveBinned(
+		BinnedInputs& binned,
+		ConstVec& vals_,
+		Vec& p_,
+		u64 numThreads,
+		Helper& h)
+	{
+		static constexpr const u64 batchSize = 32;
+
+		numThreads = std::max<u64>(1, std::min<u64>(numThreads, mNumBins));
+		auto paxosSizePer = mPaxosParam.size();
+
+		// each thread solves the bins thrdIdx, thrdIdx + numThreads, ... The 
+		// hashes are already grouped by bin, so unlike implParSolve there is
+		// no hashing pass and no barrier between the threads.
+		auto routine = [&](u64 thrdIdx)
+		{
+			auto allocSize =
+				sizeof(IdxType) * (
+					mItemsPerBin * mWeight * 2 +
+					mPaxosParam.mSparseSize
+					) +
+				sizeof(span<IdxType>) * mPaxosParam.mSparseSize;
+			std::unique_ptr<u8[]> allocation(new u8[allocSize]);
+			auto valBacking = h.newVec(mItemsPerBin);
+
+			Paxos<IdxType> paxos;
+			for (u64 binIdx = thrdIdx; binIdx < mNumBins; binIdx += numThreads)
+			{
+				auto begin = binned.mBinBegin[binIdx];
+				u64 binSize = binned.mBinBegin[binIdx + 1] - begin;
+				if (binSize > mItemsPerBin)
+					throw RTE_LOC;
+
+				paxos.init(binSize, mPaxosParam, mSeed);
+
+				auto iter = allocation.get();
+				MatrixView<IdxType> rows = initMV<IdxType>(iter, binSize, mWeight);
+				span<IdxType> colBacking = initSpan<IdxType>(iter, binSize * mWeight);
+				span<IdxType> colWeights = initSpan<IdxType>(iter, mPaxosParam.mSparseSize);
+				span<span<IdxType>> cols = initSpan<span<IdxType>>(iter, mPaxosParam.mSparseSize);
+
+				span<block> hashes(binned.mHashes.data() + begin, binSize);
+				auto values = valBacking.subspan(0, binSize);
+				for (u64 i = 0; i < binSize; ++i)
+					h.assign(values[i], vals_[binned.mInIdxs[begin + i]]);
+
+				std::memset(colWeights.data(), 0, colWeights.size() * sizeof(IdxType));
+				auto rIter = rows.data();
+				u64 i = 0;
+				if (mWeight == 3)
+				{
+					for (; i + batchSize <= binSize; i += batchSize)
+					{
+						paxos.mHasher.buildRow32(&hashes[i], rIter);
+						for (u64 j = 0; j < batchSize * mWeight; ++j)
+							++colWeights[rIter[j]];
+						rIter += batchSize * mWeight;
+					}
+				}
+				for (; i < binSize; ++i)
+				{
+					paxos.mHasher.buildRow(hashes[i], rIter);
+					for (u64 k = 0; k < mWeight; ++k)
+						++colWeights[rIter[k]];
+					rIter += mWeight;
+				}
+
+				auto output = p_.subspan(paxosSizePer * binIdx, paxosSizePer);
+				paxos.setInput(rows, hashes, cols, colBacking, colWeights);
+				paxos.encode(values, output, h, nullptr);
+				if (mBinDone)
+					mBinDone(paxosSizePer * binIdx, paxosSizePer * (binIdx + 1));
+			}
+		};
+
+		std::vector<std::thread> thrds(numThreads - 1);
+		for (u64 i = 0; i < thrds.size(); ++i)
+			thrds[i] = std::thread(routine, i);
+
+		routine(thrds.size());
+
+		for (u64 i = 0; i < thrds.size(); ++i)
+			thrds[i].join();
+	}
+
+	template<typename ValueType>
+	void Baxos::decodeBin(u64 binIdx, BinnedInputs& binned, MatrixView<ValueType> values, MatrixView<const ValueType> p)
+	{
+		if (values.cols() != p.cols() || p.rows() != size() || binIdx >= mNumBins ||
+			binned.mBinBegin.size() != mNumBins + 1)
+			throw RTE_LOC;
+
+		PxMatrix<ValueType> V(values);
+		PxMatrix<const ValueType> P(p);
+		auto h = V.defaultHelper();
+
+		auto bitLength = oc::roundUpTo(oc::log2ceil((u64)(mPaxosParam.mSparseSize + 1)), 8);
+		if (bitLength <= 8)
+			implDecodeBinned<u8>(binIdx, binned, V, P, h);
+		else if (bitLength <= 16)
+			implDecodeBinned<u16>(binIdx, binned, V, P, h);
+		else if (bitLength <= 32)
+			implDecodeBinned<u32>(binIdx, binned, V, P, h);
+		else
+			implDecodeBinned<u64>(binIdx, binned, V, P, h);
+	}
+
+
+	template<typename IdxType, typename Vec, typename ConstVec, typename Helper>
+	void Baxos::implDecodeBinned(u64 binIdx, BinnedInputs& binned, Vec& values, ConstVec& pp, Helper& h)
+	{
+		auto begin = binned.mBinBegin[binIdx];
+		auto end = binned.mBinBegin[binIdx + 1];
+		if (begin == end)
+			return;
+
+		Paxos<IdxType> paxos;
+		paxos.init(1, mPaxosParam, mSeed);
+		auto buff = h.newVec(32);
+
+		auto sizePer = size() / mNumBins;
+		auto p = pp.subspan(binIdx * sizePer, sizePer);
+		span<block> hashes(binned.mHashes.data() + begin, end - begin);
+		span<u64> inIdxs(binned.mInIdxs.data() + begin, end - begin);
+		implDecodeBin(binIdx, hashes, values, buff, inIdxs, p, h, paxos);
+	}
+
 }
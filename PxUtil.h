@@ -445,16 +445,37 @@ namespace volePSI
 	};
 
 
+	// The method used to reduce a hash into [0, modulus). This changes which
+	// columns a key maps to, so the encoder and decoder must use the same mode.
+	// The values are a version number and should not be reused.
+	enum class PaxosHashMode : u8
+	{
+		// hash % modulus, vectorized with libdivide.
+		LibDivide = 1,
+
+		// (hash * modulus) >> 64, aka fast range. Value 2 was an earlier
+		// fast range mode whose Baxos bin index reused the column bits.
+		FastRange = 3
+	};
+
+	// maps the uniform value v into [0, modulus) using a multiply-high.
+	inline u64 fastRange(u64 v, u64 modulus)
+	{
+		return static_cast<u64>((static_cast<unsigned __int128>(v) * modulus) >> 64);
+	}
+
 	template<typename IdxType>
 	struct PaxosHash
 	{
 		u64 mWeight, mSparseSize, mIdxSize;
+		PaxosHashMode mMode = PaxosHashMode::LibDivide;
 		oc::AES mAes;
 		std::vector<libdivide::libdivide_u64_t> mMods;
 		//std::vector<libdivide::libdivide_u64_branchfree_t> mModsBF;
 		std::vector<u64> mModVals;
-		void init(block seed, u64 weight, u64 paxosSize)
+		void init(block seed, u64 weight, u64 paxosSize, PaxosHashMode mode = PaxosHashMode::LibDivide)
 		{
+			mMode = mode;
 			mWeight = weight;
 			mSparseSize = paxosSize;
 			mIdxSize = static_cast<IdxType>(oc::roundUpTo(oc::log2ceil(mSparseSize), 8) / 8);
@@ -475,6 +496,14 @@ namespace volePSI
 
 		void mod32(u64* vals, u64 modIdx) const;
 
+		// reduce v modulo mModVals[modIdx] using mMode.
+		u64 mod(u64 v, u64 modIdx) const
+		{
+			if (mMode == PaxosHashMode::FastRange)
+				return fastRange(v, mModVals[modIdx]);
+			return v % mModVals[modIdx];
+		}
+
 		void hashBuildRow32(const block* input, IdxType* rows, block* hash) const;
 		//void hashBuildRow8(const block* input, IdxType* rows, block* hash) const;
 		void hashBuildRow1(const block* input, IdxType* rows, block* hash) const;
@@ -1,28 +1,234 @@
 #include "RsOprf.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <deque>
+#include <algorithm>
+#ifdef OC_ENABLE_PCLMUL
+#include <immintrin.h>
+#endif
 
 namespace volePSI
 {
+#ifdef OC_ENABLE_PCLMUL
+	// b[i] ^= d * p[i] in GF(2^128), with the same multiply and reduction as
+	// block::gf128Mul. 8 independent blocks are kept in flight to hide the PCLMUL latency.
+	void gf128MulXor128(const block& d, const block* __restrict p, block* __restrict b, u64 n)
+	{
+		const __m128i dd = _mm_loadu_si128((const __m128i*) & d);
+		const __m128i mod = _mm_set_epi64x(0, 0b10000111);
+
+		auto mulReduce = [&](__m128i x) {
+			__m128i lo = _mm_clmulepi64_si128(dd, x, 0x00);
+			__m128i hi = _mm_clmulepi64_si128(dd, x, 0x11);
+			__m128i mid = _mm_xor_si128(_mm_clmulepi64_si128(dd, x, 0x10), _mm_clmulepi64_si128(dd, x, 0x01));
+			lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+			hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+			__m128i t = _mm_clmulepi64_si128(hi, mod, 0x01);
+			lo = _mm_xor_si128(lo, _mm_slli_si128(t, 8));
+			hi = _mm_xor_si128(hi, _mm_srli_si128(t, 8));
+			t = _mm_clmulepi64_si128(hi, mod, 0x00);
+			return _mm_xor_si128(lo, t);
+		};
+
+		auto main = n / 8 * 8;
+		u64 i = 0;
+		for (; i < main; i += 8)
+		{
+			__m128i r[8];
+			for (u64 j = 0; j < 8; ++j)
+				r[j] = mulReduce(_mm_loadu_si128((const __m128i*)(p + i + j)));
+			for (u64 j = 0; j < 8; ++j)
+				_mm_storeu_si128((__m128i*)(b + i + j), _mm_xor_si128(_mm_loadu_si128((const __m128i*)(b + i + j)), r[j]));
+		}
+		for (; i < n; ++i)
+			_mm_storeu_si128((__m128i*)(b + i), _mm_xor_si128(_mm_loadu_si128((const __m128i*)(b + i)),
+				mulReduce(_mm_loadu_si128((const __m128i*)(p + i)))));
+	}
+
+#define VPCLMUL_FN __attribute__((target("avx512f,vpclmulqdq")))
+
+	// per 128 bit lane: slli_si128(x, 8) and srli_si128(x, 8)
+	VPCLMUL_FN inline __m512i laneUp(__m512i x) { return _mm512_maskz_unpacklo_epi64(0xFF, _mm512_setzero_si512(), x); }
+	VPCLMUL_FN inline __m512i laneDown(__m512i x) { return _mm512_maskz_unpackhi_epi64(0xFF, x, _mm512_setzero_si512()); }
+
+	// d * x for the 4 blocks of x, d broadcast to every lane of dd.
+	VPCLMUL_FN inline __m512i gf128MulReduce512(__m512i dd, __m512i mod, __m512i x)
+	{
+		__m512i lo = _mm512_clmulepi64_epi128(dd, x, 0x00);
+		__m512i hi = _mm512_clmulepi64_epi128(dd, x, 0x11);
+		__m512i mid = _mm512_xor_si512(_mm512_clmulepi64_epi128(dd, x, 0x10), _mm512_clmulepi64_epi128(dd, x, 0x01));
+		lo = _mm512_xor_si512(lo, laneUp(mid));
+		hi = _mm512_xor_si512(hi, laneDown(mid));
+
+		__m512i t = _mm512_clmulepi64_epi128(hi, mod, 0x01);
+		lo = _mm512_xor_si512(lo, laneUp(t));
+		hi = _mm512_xor_si512(hi, laneDown(t));
+		t = _mm512_clmulepi64_epi128(hi, mod, 0x00);
+		return _mm512_xor_si512(lo, t);
+	}
+
+	// gf128MulXor128 with VPCLMULQDQ, 4 blocks per instruction and 16 blocks in flight.
+	VPCLMUL_FN void gf128MulXor512(const block& d, const block* __restrict p, block* __restrict b, u64 n)
+	{
+		const __m512i dd = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128((const __m128i*) & d));
+		const __m512i mod = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_set_epi64x(0, 0b10000111));
+
+		auto main = n / 16 * 16;
+		u64 i = 0;
+		for (; i < main; i += 16)
+		{
+			__m512i r[4];
+			for (u64 j = 0; j < 4; ++j)
+				r[j] = gf128MulReduce512(dd, mod, _mm512_loadu_si512(p + i + 4 * j));
+			for (u64 j = 0; j < 4; ++j)
+				_mm512_storeu_si512(b + i + 4 * j, _mm512_xor_si512(_mm512_loadu_si512(b + i + 4 * j), r[j]));
+		}
+		gf128MulXor128(d, p + i, b + i, n - i);
+	}
+#endif
+
+	// b[i] ^= d * p[i] for i < n, using the widest carry-less multiply the cpu has.
+	void gf128MulXor(const block& d, const block* __restrict p, block* __restrict b, u64 n)
+	{
+#ifdef OC_ENABLE_PCLMUL
+		static const bool wide = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("vpclmulqdq");
+		if (wide)
+			gf128MulXor512(d, p, b, n);
+		else
+			gf128MulXor128(d, p, b, n);
+#else
+		for (u64 i = 0; i < n; ++i)
+			b[i] = b[i] ^ d.gf128Mul(p[i]);
+#endif
+	}
+
+	// The sender's side of the receiver's message: the chunks of p ^ c are received
+	// into a ring of buffers and unmasked into mB by a pool of workers while the next
+	// chunk is still arriving. A buffer is reused once every slice of it is done.
+	struct UnmaskRing
+	{
+		struct Job
+		{
+			u64 slot;
+			const block* p;
+			block* b;
+			u64 n;
+		};
+
+		std::mutex mMtx;
+		std::condition_variable mWorkCv, mDoneCv;
+		std::deque<Job> mJobs;
+		std::vector<std::unique_ptr<block[]>> mBuffs;
+		// the number of unfinished slices per buffer.
+		std::vector<u64> mPending;
+		std::vector<std::thread> mThrds;
+		u64 mBuffSize = 0, mNumThreads = 1;
+		block mD;
+		bool mStop = false;
+
+		void init(u64 numSlots, u64 buffSize, const block& d, u64 numThreads)
+		{
+			mBuffSize = buffSize;
+			mD = d;
+			mNumThreads = std::max<u64>(1, numThreads);
+			mBuffs.resize(numSlots);
+			for (auto& bb : mBuffs)
+				bb.reset(new block[buffSize]);
+			mPending.assign(numSlots, 0);
+			for (u64 i = 0; i < mNumThreads; ++i)
+				mThrds.emplace_back([this] { work(); });
+		}
+
+		~UnmaskRing()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mMtx);
+				mStop = true;
+			}
+			mWorkCv.notify_all();
+			for (auto& t : mThrds)
+				t.join();
+		}
+
+		void work()
+		{
+			std::unique_lock<std::mutex> lock(mMtx);
+			while (true)
+			{
+				mWorkCv.wait(lock, [&] { return mStop || mJobs.size(); });
+				if (mJobs.empty())
+					return;
+				auto job = mJobs.front();
+				mJobs.pop_front();
+
+				lock.unlock();
+				gf128MulXor(mD, job.p, job.b, job.n);
+				lock.lock();
+
+				if (--mPending[job.slot] == 0)
+					mDoneCv.notify_all();
+			}
+		}
+
+		// blocks until buffer slot is free and returns its first n blocks.
+		span<block> acquire(u64 slot, u64 n)
+		{
+			std::unique_lock<std::mutex> lock(mMtx);
+			mDoneCv.wait(lock, [&] { return mPending[slot] == 0; });
+			return span<block>(mBuffs[slot].get(), n);
+		}
+
+		// splits b ^= d * p over the workers. p must be the span acquired for slot.
+		void submit(u64 slot, span<const block> p, span<block> b)
+		{
+			auto slice = std::max<u64>(1 << 12, oc::divCeil(p.size(), mNumThreads));
+			{
+				std::lock_guard<std::mutex> lock(mMtx);
+				for (u64 i = 0; i < p.size(); i += slice)
+				{
+					auto n = std::min<u64>(slice, p.size() - i);
+					mJobs.push_back({ slot, p.data() + i, b.data() + i, n });
+					++mPending[slot];
+				}
+			}
+			mWorkCv.notify_all();
+		}
+
+		// blocks until every submitted slice is done.
+		void finish()
+		{
+			std::unique_lock<std::mutex> lock(mMtx);
+			mDoneCv.wait(lock, [&] {
+				return std::all_of(mPending.begin(), mPending.end(), [](u64 c) { return c == 0; });
+			});
+		}
+	};
+
 	Proto RsOprfSender::send(u64 n, PRNG& prng, Socket& chl, u64 numThreads, bool reducedRounds)
 	{
 		auto ws = block{};
 		auto hBuff = std::array<u8, 32> {};
 		auto ro = oc::RandomOracle(32);
-		auto pPtr = std::unique_ptr<block[]>{};
-		auto pp = span<block>{};
 		auto subPp = span<block>{};
 		auto remB = span<block>{};
 		auto subB = span<block>{};
 		auto fu = macoro::eager_task<void>{};
 		auto recvIdx = u64{ 0 };
+		auto buffSize = u64{ 0 };
 		auto fork = Socket{};
+		auto ring = std::make_unique<UnmaskRing>();
+		auto seedMsg = std::array<block, 2>{};
+		auto lease = VolePool::Lease{};
 
 		setTimePoint("RsOprfSender::send-begin");
 		ws = prng.get();
 
 		mPaxos.init(n, mBinSize, 3, mSsp, PaxosParam::GF128, oc::ZeroBlock);
 
-		mD = prng.get();
-
 		if (mMalicious)
 		{
 			mVoleSender.mMalType = oc::SilentSecType::Malicious;
@@ -37,15 +243,40 @@ namespace volePSI
 		numThreads = std::max<u64>(1, numThreads);
 		//mVoleSender.mNumThreads = numThreads;
 		// a + b  = c * d
-		fork = chl.fork();
-		fu = genVole(prng, fork, reducedRounds)
-			| macoro::make_eager();
-
-		co_await(chl.recv(mPaxos.mSeed));
-		setTimePoint("RsOprfSender::recv-seed");
-		co_await(fu);
-		mB = mVoleSender.mB;
-		setTimePoint("RsOprfSender::send-vole");
+		if (mPool)
+		{
+			if (mPool->malicious() != mMalicious)
+				throw std::runtime_error("RsOprfSender: the VolePool was produced with a different security type. " LOCATION);
+
+			// the receiver sends its hashing seed together with the tag of the pool
+			// entry it uses, which must be the entry we take. b is unmasked in place
+			// and used by eval, so it is copied out and the slot is freed right away.
+			lease = mPool->take(mPaxos.size());
+			mD = lease->mD;
+			mPoolB.assign(lease->mB.begin(), lease->mB.begin() + mPaxos.size());
+			mB = mPoolB;
+			lease.reset();
+			setTimePoint("RsOprfSender::send-pool");
+
+			co_await(chl.recv(seedMsg));
+			mPaxos.mSeed = seedMsg[0];
+			if (seedMsg[1] != lease->mTag)
+				throw std::runtime_error("RsOprfSender: the receiver used a different VolePool entry. " LOCATION);
+			setTimePoint("RsOprfSender::recv-seed");
+		}
+		else
+		{
+			mD = prng.get();
+			fork = chl.fork();
+			fu = genVole(prng, fork, reducedRounds)
+				| macoro::make_eager();
+
+			co_await(chl.recv(mPaxos.mSeed));
+			setTimePoint("RsOprfSender::recv-seed");
+			co_await(fu);
+			mB = mVoleSender.mB;
+			setTimePoint("RsOprfSender::send-vole");
+		}
 
 
 
@@ -58,91 +289,30 @@ namespace volePSI
 			setTimePoint("RsOprfSender::recv-mal");
 		}
 
-		pPtr.reset(new block[mPaxos.size()]);
-		pp = span<block>(pPtr.get(), mPaxos.size());
-
+		// the receiver's message arrives in oprfMsgBins sized chunks. Each chunk is
+		// received into the next buffer of the ring while the workers unmask the
+		// previous ones, so after the last byte only the last chunk remains. Small
+		// inputs arrive in fewer chunks than the ring has buffers, so it is trimmed.
+		buffSize = std::min<u64>(oprfMsgBins(mPaxos) * mPaxos.mPaxosParam.size(), mPaxos.size());
+		ring->init(std::min<u64>(4, oc::divCeil(mPaxos.size(), buffSize)), buffSize, mD, numThreads);
+		remB = mB.subspan(0, mPaxos.size());
 		setTimePoint("RsOprfSender::alloc ");
 
-		if (0)
+		while (remB.size())
 		{
-			co_await(chl.recv(pp));
+			subB = remB.subspan(0, std::min<u64>(remB.size(), ring->mBuffSize));
+			remB = remB.subspan(subB.size());
 
-			setTimePoint("RsOprfSender::send-recv");
-			{
+			subPp = ring->acquire(recvIdx % ring->mBuffs.size(), subB.size());
+			co_await chl.recv(subPp);
+			ring->submit(recvIdx % ring->mBuffs.size(), subPp, subB);
 
-				auto main = mB.size() / 8 * 8;
-				auto b = mB.data();
-				auto p = pp.data();
-				for (u64 i = 0; i < main; i += 8)
-				{
-					b[0] = b[0] ^ mD.gf128Mul(p[0]);
-					b[1] = b[1] ^ mD.gf128Mul(p[1]);
-					b[2] = b[2] ^ mD.gf128Mul(p[2]);
-					b[3] = b[3] ^ mD.gf128Mul(p[3]);
-					b[4] = b[4] ^ mD.gf128Mul(p[4]);
-					b[5] = b[5] ^ mD.gf128Mul(p[5]);
-					b[6] = b[6] ^ mD.gf128Mul(p[6]);
-					b[7] = b[7] ^ mD.gf128Mul(p[7]);
-
-					b += 8;
-					p += 8;
-				}
-
-				for (u64 i = main; i < mB.size(); ++i)
-				{
-					mB[i] = mB[i] ^ mD.gf128Mul(pp[i]);
-				}
-			}
-			setTimePoint("RsOprfSender::send-gf128Mul");
+			++recvIdx;
 		}
-		else
-		{
-			remB = mB;
-
-			while (pp.size())
-			{
+		setTimePoint("RsOprfSender::send-recv");
 
-				subPp = pp.subspan(0, std::min<u64>(pp.size(), 1 << 28));
-				pp = pp.subspan(subPp.size());
-
-				subB = remB.subspan(0, subPp.size());
-				remB = remB.subspan(subPp.size());
-
-				setTimePoint("RsOprfSender::pre*-" + std::to_string(recvIdx));
-				co_await chl.recv(subPp);
-				setTimePoint("RsOprfSender::recv-" + std::to_string(recvIdx));
-
-				{
-
-					auto main = subB.size() / 8 * 8;
-					auto b = subB.data();
-					auto p = subPp.data();
-					for (u64 i = 0; i < main; i += 8)
-					{
-						b[0] = b[0] ^ mD.gf128Mul(p[0]);
-						b[1] = b[1] ^ mD.gf128Mul(p[1]);
-						b[2] = b[2] ^ mD.gf128Mul(p[2]);
-						b[3] = b[3] ^ mD.gf128Mul(p[3]);
-						b[4] = b[4] ^ mD.gf128Mul(p[4]);
-						b[5] = b[5] ^ mD.gf128Mul(p[5]);
-						b[6] = b[6] ^ mD.gf128Mul(p[6]);
-						b[7] = b[7] ^ mD.gf128Mul(p[7]);
-
-						b += 8;
-						p += 8;
-					}
-
-					for (u64 i = main; i < subB.size(); ++i, ++b, ++p)
-					{
-						*b = *b ^ mD.gf128Mul(*p);
-					}
-				}
-				setTimePoint("RsOprfSender::gf128Mul-" + std::to_string(recvIdx));
-
-				++recvIdx;
-
-			}
-		}
+		ring->finish();
+		setTimePoint("RsOprfSender::send-gf128Mul");
 	}
 
 	block RsOprfSender::eval(block v)
@@ -263,6 +433,147 @@ namespace volePSI
 		}
 	};
 
+	// The receiver's message p ^ c is computed one Baxos bin at a time. mark(bin) is
+	// called once the bin has been solved and masked; bins [0, mPrefix) are ready to send.
+	struct BinPipeline
+	{
+		std::mutex mMtx;
+		std::condition_variable mCv;
+		span<block> mP, mC;
+		u64 mBinSize = 0;
+		std::vector<u8> mMasked;
+		// bins that were solved before the vole finished.
+		std::vector<u64> mBacklog;
+		u64 mPrefix = 0;
+		bool mHaveC = false;
+		std::exception_ptr mError;
+		std::thread mThrd;
+
+		~BinPipeline()
+		{
+			if (mThrd.joinable())
+				mThrd.join();
+		}
+
+		void init(span<block> p, u64 numBins, u64 binSize)
+		{
+			mP = p;
+			mBinSize = binSize;
+			mMasked.assign(numBins, 0);
+			mBacklog.clear();
+			mPrefix = 0;
+			mHaveC = false;
+			mError = nullptr;
+		}
+
+		void mask(u64 bin)
+		{
+			auto main = mBinSize / 8 * 8;
+			block* __restrict pp = mP.data() + bin * mBinSize;
+			block* __restrict cc = mC.data() + bin * mBinSize;
+			for (u64 i = 0; i < main; i += 8)
+			{
+				pp[0] = pp[0] ^ cc[0];
+				pp[1] = pp[1] ^ cc[1];
+				pp[2] = pp[2] ^ cc[2];
+				pp[3] = pp[3] ^ cc[3];
+				pp[4] = pp[4] ^ cc[4];
+				pp[5] = pp[5] ^ cc[5];
+				pp[6] = pp[6] ^ cc[6];
+				pp[7] = pp[7] ^ cc[7];
+
+				pp += 8;
+				cc += 8;
+			}
+			for (u64 i = main; i < mBinSize; ++i, ++pp, ++cc)
+				*pp = *pp ^ *cc;
+		}
+
+		// requires the lock.
+		void mark(u64 bin)
+		{
+			mMasked[bin] = 1;
+			while (mPrefix < mMasked.size() && mMasked[mPrefix])
+				++mPrefix;
+		}
+
+		// runs the solve on a background thread. Called by the solving threads
+		// for each finished bin, see Baxos::mBinDone.
+		template<typename Solve>
+		void start(Solve&& solve)
+		{
+			mThrd = std::thread([this, solve = std::forward<Solve>(solve)]() mutable {
+				try {
+					solve();
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(mMtx);
+					mError = std::current_exception();
+					mCv.notify_all();
+				}
+			});
+		}
+
+		void solved(u64 begin, u64 end)
+		{
+			for (u64 bin = begin / mBinSize; bin < end / mBinSize; ++bin)
+			{
+				std::unique_lock<std::mutex> lock(mMtx);
+				if (!mHaveC)
+				{
+					mBacklog.push_back(bin);
+					continue;
+				}
+				lock.unlock();
+				mask(bin);
+				lock.lock();
+				mark(bin);
+				mCv.notify_all();
+			}
+		}
+
+		// c is now available. Masks the backlog on numThreads threads, later bins
+		// are masked by the thread that solves them.
+		void setMask(span<block> c, u64 numThreads)
+		{
+			std::vector<u64> backlog;
+			{
+				std::lock_guard<std::mutex> lock(mMtx);
+				mC = c;
+				mHaveC = true;
+				backlog.swap(mBacklog);
+			}
+
+			std::atomic<u64> next(0);
+			auto routine = [&] {
+				for (u64 i = next++; i < backlog.size(); i = next++)
+					mask(backlog[i]);
+			};
+			std::vector<std::thread> thrds(std::min<u64>(std::max<u64>(1, numThreads), backlog.size() / 2 + 1) - 1);
+			for (auto& t : thrds)
+				t = std::thread(routine);
+			routine();
+			for (auto& t : thrds)
+				t.join();
+
+			std::lock_guard<std::mutex> lock(mMtx);
+			for (auto bin : backlog)
+				mark(bin);
+			mCv.notify_all();
+		}
+
+		// blocks until the bins [begin, end) have been masked and returns their part of p.
+		span<block> wait(u64 begin, u64 end)
+		{
+			std::unique_lock<std::mutex> lock(mMtx);
+			mCv.wait(lock, [&] { return mPrefix >= end || mError; });
+			if (mError)
+				std::rethrow_exception(mError);
+			return mP.subspan(begin * mBinSize, (end - begin) * mBinSize);
+		}
+	};
+
 	Proto RsOprfReceiver::receive(span<const block> values, span<block> outputs, PRNG& prng, Socket& chl, u64 numThreads, bool reducedRounds)
 	{
 
@@ -275,12 +586,16 @@ namespace volePSI
 		auto h = span<block>{};
 		auto p = UninitVec{};
 		auto subP = span<block>{};
-		auto subC = span<block>{};
 		auto a = span<block>{};
 		auto c = span<block>{};
 		auto fu = macoro::eager_task<void>{};
 		auto ii = u64{ 0 };
+		auto msgBins = u64{ 0 };
 		auto fork = Socket{};
+		auto pipe = std::make_unique<BinPipeline>();
+		// freed on every exit path, an exception included, so the pool is never
+		// left with a lease that blocks later sessions.
+		auto lease = VolePool::Lease{};
 
 		setTimePoint("RsOprfReceiver::receive-begin");
 
@@ -291,7 +606,17 @@ namespace volePSI
 		paxos.mDebug = mDebug;
 		paxos.init(values.size(), mBinSize, 3, mSsp, PaxosParam::GF128, hashingSeed);
 
-		co_await(chl.send(std::move(hashingSeed)));
+		if (mPool)
+		{
+			if (mPool->malicious() != mMalicious)
+				throw std::runtime_error("RsOprfReceiver: the VolePool was produced with a different security type. " LOCATION);
+
+			lease = mPool->take(paxos.size());
+			setTimePoint("RsOprfReceiver::receive-pool");
+			co_await(chl.send(std::array<block, 2>{ hashingSeed, lease->mTag }));
+		}
+		else
+			co_await(chl.send(std::move(hashingSeed)));
 
 		if (mMalicious)
 		{
@@ -302,9 +627,12 @@ namespace volePSI
 		if (mTimer)
 			mVoleRecver.setTimer(*mTimer);
 
-		fork = chl.fork();
-		fu = genVole(paxos.size(), prng, fork, reducedRounds)
-			| macoro::make_eager();
+		if (!mPool)
+		{
+			fork = chl.fork();
+			fu = genVole(paxos.size(), prng, fork, reducedRounds)
+				| macoro::make_eager();
+		}
 
 
 
@@ -321,15 +649,32 @@ namespace volePSI
 
 		setTimePoint("RsOprfReceiver::receive-alloc");
 
-		paxos.solve<block>(values, h, p, nullptr, numThreads);
-		setTimePoint("RsOprfReceiver::receive-solve");
-		co_await(fu);
+		// solve, mask and send are pipelined per bin. The bins are solved in the
+		// background while the vole runs. Once c is known, each solving thread masks
+		// its bins as it finishes them, and p is sent in groups of oprfMsgBins bins
+		// as soon as all bins of the group are masked.
+		// With a pool, c is known up front and every bin is masked by its solving thread.
+		pipe->init(p, paxos.mNumBins, paxos.mPaxosParam.size());
+		paxos.mBinDone = [&pipe](u64 begin, u64 end) { pipe->solved(begin, end); };
+		if (mPool)
+		{
+			// a + b  = c * d
+			a = lease->mA.subspan(0, paxos.size());
+			c = lease->mC.subspan(0, paxos.size());
+			pipe->setMask(c, numThreads);
+		}
+		pipe->start([&] { paxos.solve<block>(values, h, p, nullptr, numThreads); });
 
-		// a + b  = c * d
-		a = mVoleRecver.mA;
-		c = mVoleRecver.mC;
+		if (!mPool)
+		{
+			co_await(fu);
+
+			// a + b  = c * d
+			a = mVoleRecver.mA;
+			c = mVoleRecver.mC;
 
-		setTimePoint("RsOprfReceiver::receive-vole");
+			setTimePoint("RsOprfReceiver::receive-vole");
+		}
 
 
 		if (mMalicious)
@@ -337,90 +682,26 @@ namespace volePSI
 			co_await(chl.send(std::move(wr)));
 		}
 
-
-		//if (numThreads > 1)
-		//    thrd.join();
-		if (0)
+		if (!mPool)
 		{
-			{
-				auto main = (p.size() / 8) * 8;
-				block* __restrict pp = p.data();
-				block* __restrict cc = c.data();
-				for (u64 i = 0; i < main; i += 8)
-				{
-					pp[0] = pp[0] ^ cc[0];
-					pp[1] = pp[1] ^ cc[1];
-					pp[2] = pp[2] ^ cc[2];
-					pp[3] = pp[3] ^ cc[3];
-					pp[4] = pp[4] ^ cc[4];
-					pp[5] = pp[5] ^ cc[5];
-					pp[6] = pp[6] ^ cc[6];
-					pp[7] = pp[7] ^ cc[7];
-
-					pp += 8;
-					cc += 8;
-				}
-				for (u64 i = main; i < p.size(); ++i)
-					p[i] = p[i] ^ c[i];
-			}
-
-			setTimePoint("RsOprfReceiver::receive-xor");
-
-			// send c ^ p
-			co_await(chl.send(std::move(p)));
+			pipe->setMask(c, numThreads);
+			setTimePoint("RsOprfReceiver::receive-backlog");
 		}
-		else
-		{
-			ii = 0;
-
-			while (c.size())
-			{
-
-				subP = p.subspan(0, std::min<u64>(p.size(), 1 << 28));
-				subC = c.subspan(0, subP.size());
-
-				if (p.size() != subP.size())
-					static_cast<span<block>&>(p) = p.subspan(subP.size());
-				c = c.subspan(subP.size());
-
-				{
-
-					auto main = (subP.size() / 8) * 8;
-					block* __restrict pp = subP.data();
-					block* __restrict cc = subC.data();
-					for (u64 i = 0; i < main; i += 8)
-					{
-						pp[0] = pp[0] ^ cc[0];
-						pp[1] = pp[1] ^ cc[1];
-						pp[2] = pp[2] ^ cc[2];
-						pp[3] = pp[3] ^ cc[3];
-						pp[4] = pp[4] ^ cc[4];
-						pp[5] = pp[5] ^ cc[5];
-						pp[6] = pp[6] ^ cc[6];
-						pp[7] = pp[7] ^ cc[7];
-
-						pp += 8;
-						cc += 8;
-					}
-					for (u64 i = main; i < p.size(); ++i, ++pp, ++cc)
-						*pp = *pp ^ *cc;
-				}
-
-				setTimePoint("RsOprfReceiver::receive-xor");
-
-				if (p.size() != subP.size())
-					co_await(chl.send(std::move(subP)));
-				else
-					co_await(chl.send(std::move(p)));
-
-				setTimePoint("RsOprfReceiver::receive-send");
-
-				++ii;
-			}
 
+		msgBins = oprfMsgBins(paxos);
+		for (ii = 0; ii < paxos.mNumBins; ii += msgBins)
+		{
+			subP = pipe->wait(ii, std::min<u64>(ii + msgBins, paxos.mNumBins));
+			co_await(chl.send(std::move(subP)));
 		}
+		setTimePoint("RsOprfReceiver::receive-send");
+
+		pipe->mThrd.join();
+		paxos.mBinDone = nullptr;
+		setTimePoint("RsOprfReceiver::receive-join");
 
 		paxos.decode<block>(values, outputs, a, numThreads);
+		lease.reset();
 
 		setTimePoint("RsOprfReceiver::receive-decode");
 
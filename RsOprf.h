@@ -1,11 +1,29 @@
 #pragma once
 #include "Defines.h"
 #include "Paxos.h"
+#include "VolePool.h"
 #include "libOTe/Vole/Silent/SilentVoleSender.h"
 #include "libOTe/Vole/Silent/SilentVoleReceiver.h"
 
 namespace volePSI
 {
+    // The receiver sends p ^ c as messages of whole Baxos bins, at least 2^16
+    // blocks each, so that a message can be sent as soon as its bins are solved.
+    // Both parties must split p the same way.
+    inline u64 oprfMsgBins(const Baxos& paxos)
+    {
+        auto binSize = std::max<u64>(1, paxos.mPaxosParam.size());
+        return std::max<u64>(1, ((1ull << 16) + binSize - 1) / binSize);
+    }
+
+    // The number of VOLE correlations an OPRF on n receiver values consumes, i.e. the
+    // entry size a VolePool needs for it.
+    inline u64 oprfVoleSize(u64 n, u64 binSize = 1 << 14, u64 ssp = 40)
+    {
+        Baxos paxos;
+        paxos.init(n, binSize, 3, ssp, PaxosParam::GF128, oc::ZeroBlock);
+        return paxos.size();
+    }
 
     class RsOprfSender : public oc::TimerAdapter
     {
@@ -20,6 +38,12 @@ namespace volePSI
         u64 mSsp = 40;
         bool mDebug = false;
 
+        // if set, send() takes its correlation from the pool instead of running
+        // silent VOLE. b is copied into mPoolB, which mB then points to, and the
+        // pool entry is released before send() returns.
+        VolePool* mPool = nullptr;
+        std::vector<block> mPoolB;
+
         void setMultType(oc::MultType type) { mVoleSender.mMultType = type; };
 
         Proto send(u64 n, PRNG& prng, Socket& chl, u64 mNumThreads = 0, bool reducedRounds = false);
@@ -46,6 +70,10 @@ namespace volePSI
         u64 mSsp = 40;
         bool mDebug = false;
 
+        // if set, receive() takes its correlation from the pool instead of running
+        // silent VOLE. The peer's sender must use the matching pool.
+        VolePool* mPool = nullptr;
+
         void setMultType(oc::MultType type) { mVoleRecver.mMultType = type; };
 
         Proto receive(span<const block> values, span<block> outputs, PRNG& prng, Socket& chl, u64 mNumThreads = 0, bool reducedRounds = false);
@@ -11,6 +11,8 @@
 #include "cryptoTools/Common/Defines.h"
 #include "cryptoTools/Common/BitVector.h"
 #include "cryptoTools/Common/Matrix.h"
+#include <ostream>
+#include <cassert>
 namespace volePSI
 {
 
@@ -19,43 +21,38 @@ namespace volePSI
     public:
 
 
+        // A compact bin entry, 5 bytes instead of 8 so that
+        // inserting moves less memory.
+#pragma pack(push, 1)
         struct Item
         {
-            Item() :mVal(-1) {}
-
+            Item() : mIdx(-1), mHashIdx(-1) {}
+            Item(const Item&) = default;
             Item& operator=(const Item&) = default;
 
-            bool isEmpty() const { return mVal == u64(-1); }
+            bool isEmpty() const { return mIdx == u32(-1); }
 
             // The index is the index of the input that currently
-            // occupies this bin position. The index is encode in the
-            // first 7 bytes.
-            u64 idx() const { return mVal  & (u64(-1) >> 8); }
+            // occupies this bin position.
+            u64 idx() const { return mIdx; }
 
             // The index of the hash function that this item is 
-            // currently using. This in is encoded in the 8th byte.
-            u64 hashIdx() const { return ((u8*)&mVal)[7]; }
-
-            // Return true if this item was set with a collition.
-            //bool isCollision() const { return  (((u8*)&mVal)[7] >> 7) > 0; }
+            // currently using.
+            u64 hashIdx() const { return mHashIdx; }
 
             // The this item to contain the index idx under the given hash index.
-            // The collision value is also encoded.
             void set(u64 idx, u8 hashIdx)
             {
-                mVal = idx;
-                ((u8*)&mVal)[7] = hashIdx;
+                assert(idx < u32(-1));
+                mIdx = static_cast<u32>(idx);
+                mHashIdx = hashIdx;
             }
-#ifdef THREAD_SAFE_SIMPLE_INDEX
-            Item(const Item& b) : mVal(b.mVal.load(std::memory_order_relaxed)) {}
-            Item(Item&& b) : mVal(b.mVal.load(std::memory_order_relaxed)) {}
-            std::atomic<u64> mVal;
-#else
-            Item(const Item& b) : mVal(b.mVal) {}
-            Item(Item&& b) : mVal(b.mVal) {}
-            u64 mVal;
-#endif
+
+            u32 mIdx;
+            u8 mHashIdx;
         };
+#pragma pack(pop)
+        static_assert(sizeof(Item) == 5, "SimpleIndex::Item should be packed");
 
         u64 mMaxBinSize, mNumHashFunctions;
 
@@ -66,19 +63,31 @@ namespace volePSI
         u64 mNumBins;
 
         // numBalls x mNumHashFunctions matrix, (i,j) contains the i'th items
-        // hash value under hash index j.
-        Matrix<u64> mItemToBinMap;
+        // bin index under hash index j.
+        Matrix<u32> mItemToBinMap;
 
         // The some of each bin.
         std::vector<u64> mBinSizes;
 
         block mHashSeed;
         void print() ;
+        // The bin size such that throwing numBalls into numBins overflows with
+        // probability at most 2^-statSecParam. With approx, ssp 40/64/80 are read
+        // from the precomputed BinSizeTable.h. Other queries are computed and memoized.
         static  u64 get_bin_size(u64 numBins, u64 numBalls, u64 statSecParam, bool approx = true);
+
+        // writes the source of BinSizeTable.h to out.
+        static void printBinSizeTable(std::ostream& out);
         
 
         void init(u64 numBins, u64 numBalls, u64 statSecParam = 40, u64 numHashFunction = 3);
-        void insertItems(span<block> items, block hashingSeed);
+
+        // Hash the items to their bins. Each thread hashes a contiguous part
+        // of items and counts how many items it puts in each bin. A prefix sum
+        // over the counts then gives every thread a disjoint range of each bin
+        // to write to, so no atomics are required. The result does not depend
+        // on numThreads. At most 2^32-1 items are supported.
+        void insertItems(span<block> items, block hashingSeed, u64 numThreads = 1);
     };
 
 }
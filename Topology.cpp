@@ -0,0 +1,319 @@
+// Topology.cpp
+#include "Topology.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <set>
+
+using namespace std;
+
+namespace
+{
+    string trim(const string& s)
+    {
+        auto b = s.find_first_not_of(" \t\r");
+        if (b == string::npos)
+            return "";
+        auto e = s.find_last_not_of(" \t\r");
+        return s.substr(b, e - b + 1);
+    }
+
+    bool parseU64(const string& s, uint64_t& out)
+    {
+        try {
+            size_t pos = 0;
+            out = std::stoull(s, &pos);
+            return pos == s.size();
+        } catch (...) {
+            return false;
+        }
+    }
+
+    bool parseEngine(const string& s, OkvsEngine& out)
+    {
+        if (s == "paxos")        out = OkvsEngine::Paxos;
+        else if (s == "baxos")   out = OkvsEngine::Baxos;
+        else if (s == "band64")  out = OkvsEngine::Band64;
+        else if (s == "band128") out = OkvsEngine::Band128;
+        else if (s == "band256") out = OkvsEngine::Band256;
+        else if (s == "band512") out = OkvsEngine::Band512;
+        else return false;
+        return true;
+    }
+
+    bool parseIo(const string& s, IoBackend& out)
+    {
+        if (s == "auto")        out = IoBackend::Auto;
+        else if (s == "uring")  out = IoBackend::Uring;
+        else if (s == "epoll")  out = IoBackend::Epoll;
+        else return false;
+        return true;
+    }
+
+    bool parseRole(const string& s, PartyRole& out)
+    {
+        if (s == "owner")           out = PartyRole::Owner;
+        else if (s == "relay")      out = PartyRole::Relay;
+        else if (s == "aggregator") out = PartyRole::Aggregator;
+        else return false;
+        return true;
+    }
+
+    bool parseAddr(const string& s, PartyConfig& p)
+    {
+        auto colon = s.rfind(':');
+        uint64_t port;
+        if (colon == string::npos || !parseU64(s.substr(colon + 1), port) || port > 65535)
+            return false;
+        p.host = s.substr(0, colon);
+        p.port = static_cast<uint16_t>(port);
+        return true;
+    }
+}
+
+bool Topology::load(const std::string& path)
+{
+    ifstream in(path);
+    if (!in.is_open()) {
+        cerr << "Failed to open topology " << path << endl;
+        return false;
+    }
+
+    parties.clear();
+    PartyConfig* cur = nullptr;
+
+    string line;
+    size_t lineNo = 0;
+    while (getline(in, line)) {
+        ++lineNo;
+        auto hash = line.find('#');
+        if (hash != string::npos)
+            line.resize(hash);
+        line = trim(line);
+        if (line.empty())
+            continue;
+
+        auto bad = [&](const string& what) {
+            cerr << path << ":" << lineNo << ": " << what << ": " << line << endl;
+            return false;
+        };
+
+        // [party <id>]
+        if (line.front() == '[') {
+            istringstream ss(line.substr(1, line.find(']') - 1));
+            string tag;
+            uint64_t id;
+            if (line.back() != ']' || !(ss >> tag >> id) || tag != "party")
+                return bad("expected [party <id>]");
+            parties.emplace_back();
+            cur = &parties.back();
+            cur->id = id;
+            cur->keyPath = keyPath;
+            continue;
+        }
+
+        auto eq = line.find('=');
+        if (eq == string::npos)
+            return bad("expected key = value");
+        string key = trim(line.substr(0, eq));
+        string val = trim(line.substr(eq + 1));
+        uint64_t v = 0;
+
+        if (!cur) {
+            // 全局参数
+            if (key == "bits" && parseU64(val, v))             bits = int(v);
+            else if (key == "weight" && parseU64(val, v))      weight = v;
+            else if (key == "ssp" && parseU64(val, v))         ssp = v;
+            else if (key == "seed" && parseU64(val, v))        seed = v;
+            else if (key == "dense" && (val == "gf128" || val == "binary"))
+                dt = val == "gf128" ? volePSI::PaxosParam::GF128 : volePSI::PaxosParam::Binary;
+            else if (key == "engine" && parseEngine(val, engine)) {}
+            else if (key == "transport" && (val == "tcp" || val == "inproc"))
+                transport = val == "tcp" ? Transport::Tcp : Transport::InProc;
+            else if (key == "rowCacheDir")                     rowCacheDir = val;
+            else if (key == "streams" && parseU64(val, v) && v >= 1 && v <= 64)
+                streams = v;
+            else if (key == "zeroCopy" && parseU64(val, v) && v <= 1)
+                zeroCopy = v == 1;
+            else if (key == "io" && parseIo(val, io)) {}
+            else if (key == "bounded" && parseU64(val, v) && v <= 1)
+                bounded = v == 1;
+            else if (key == "matchFile")                       matchFile = val;
+            else if (key == "matchFormat" && (val == "csv" || val == "binary"))
+                matchFormat = val == "csv" ? MatchFormat::Csv : MatchFormat::Binary;
+            else if (key == "matchTarget" && parseU64(val, v)) matchTarget = v;
+            else if (key == "numItems" && parseU64(val, v))    numItems = v;
+            else if (key == "keys")                            keyPath = val;
+            else if (key == "treeOwners" && parseU64(val, v))  treeOwners = v;
+            else if (key == "treeArity" && parseU64(val, v))   treeArity = v;
+            else if (key == "treeHost")                        treeHost = val;
+            else if (key == "basePort" && parseU64(val, v) && v <= 65535)
+                basePort = static_cast<uint16_t>(v);
+            else return bad("unknown or invalid global setting");
+        } else {
+            if (key == "role" && parseRole(val, cur->role)) {}
+            else if (key == "addr" && parseAddr(val, *cur)) {}
+            else if (key == "parent" && parseU64(val, v))      cur->parent = v;
+            else if (key == "fanIn" && parseU64(val, v))       cur->fanIn = v;
+            else if (key == "keys")                            cur->keyPath = val;
+            else if (key == "values")                          cur->valPath = val;
+            else if (key == "okvsFile")                        cur->okvsFile = val;
+            else return bad("unknown or invalid party setting");
+        }
+    }
+
+    if (parties.empty() && treeOwners)
+        return buildTree(treeOwners, treeArity);
+
+    return validate();
+}
+
+bool Topology::validate()
+{
+    set<uint64_t> ids;
+    for (auto& p : parties) {
+        if (!ids.insert(p.id).second) {
+            cerr << "Topology: duplicate party " << p.id << endl;
+            return false;
+        }
+    }
+
+    auto numRoots = std::count_if(parties.begin(), parties.end(), [](const PartyConfig& p) {
+        return p.role == PartyRole::Aggregator;
+    });
+    // 没有 [party] 段的配置只提供全局参数（例如给 simulate 用）
+    if (numRoots == 0 && !parties.empty()) {
+        cerr << "Topology: no aggregator" << endl;
+        return false;
+    }
+
+    for (auto& p : parties) {
+        if (p.role != PartyRole::Aggregator) {
+            auto parent = find(p.parent);
+            if (!parent || parent->role == PartyRole::Owner) {
+                cerr << "Topology: parent " << p.parent << " of party " << p.id
+                     << " is not a relay or aggregator" << endl;
+                return false;
+            }
+        }
+
+        if (p.role != PartyRole::Owner) {
+            auto n = numChildren(p.id);
+            if (p.fanIn == 0)
+                p.fanIn = n;
+            if (p.fanIn != n || n == 0) {
+                cerr << "Topology: party " << p.id << " has fanIn " << p.fanIn
+                     << " but " << n << " children" << endl;
+                return false;
+            }
+            if (transport == Transport::Tcp && p.port == 0) {
+                cerr << "Topology: party " << p.id << " needs addr = host:port" << endl;
+                return false;
+            }
+        }
+    }
+
+    // 沿 parent 走，必须在 parties.size() 步内到达汇总方（排除环）
+    for (auto& p : parties) {
+        auto cur = &p;
+        for (size_t steps = 0; cur->role != PartyRole::Aggregator; ++steps) {
+            if (steps == parties.size()) {
+                cerr << "Topology: party " << p.id << " is on a cycle" << endl;
+                return false;
+            }
+            cur = find(cur->parent);
+        }
+    }
+    return true;
+}
+
+bool Topology::buildTree(uint64_t numOwners, uint64_t arity)
+{
+    if (numOwners == 0 || arity < 2) {
+        cerr << "Topology: tree needs at least one owner and arity >= 2" << endl;
+        return false;
+    }
+
+    parties.clear();
+    uint64_t nextId = 1;
+    uint16_t nextPort = basePort;
+
+    auto addListener = [&](PartyRole role) -> PartyConfig& {
+        parties.emplace_back();
+        auto& p = parties.back();
+        p.id = nextId++;
+        p.role = role;
+        p.keyPath = keyPath;
+        p.host = treeHost;
+        p.port = nextPort++;
+        return p;
+    };
+
+    vector<uint64_t> level;
+    for (uint64_t i = 0; i < numOwners; ++i) {
+        parties.emplace_back();
+        auto& p = parties.back();
+        p.id = nextId++;
+        p.keyPath = keyPath;
+        level.push_back(p.id);
+    }
+
+    // 逐层分组，每组 arity 个挂到一个新的中间节点下
+    while (level.size() > arity) {
+        vector<uint64_t> next;
+        for (size_t i = 0; i < level.size(); i += arity) {
+            // 落单的节点直接进入上一层，不为它单独建中间节点
+            if (i + 1 == level.size()) {
+                next.push_back(level[i]);
+                break;
+            }
+            auto relayId = addListener(PartyRole::Relay).id;
+            for (size_t j = i; j < std::min<size_t>(i + arity, level.size()); ++j)
+                find(level[j])->parent = relayId;
+            next.push_back(relayId);
+        }
+        level = std::move(next);
+    }
+
+    auto rootId = addListener(PartyRole::Aggregator).id;
+    for (auto id : level)
+        find(id)->parent = rootId;
+
+    for (auto& p : parties)
+        p.fanIn = 0;
+    return validate();
+}
+
+uint64_t Topology::depth() const
+{
+    uint64_t d = 0;
+    for (auto& p : parties) {
+        uint64_t steps = 0;
+        for (auto cur = &p; cur->role != PartyRole::Aggregator; cur = find(cur->parent))
+            ++steps;
+        d = std::max(d, steps);
+    }
+    return d;
+}
+
+const PartyConfig* Topology::find(uint64_t id) const
+{
+    for (auto& p : parties)
+        if (p.id == id)
+            return &p;
+    return nullptr;
+}
+
+PartyConfig* Topology::find(uint64_t id)
+{
+    return const_cast<PartyConfig*>(static_cast<const Topology*>(this)->find(id));
+}
+
+uint64_t Topology::numChildren(uint64_t id) const
+{
+    return std::count_if(parties.begin(), parties.end(), [&](const PartyConfig& p) {
+        return p.role != PartyRole::Aggregator && p.parent == id;
+    });
+}
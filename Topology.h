@@ -0,0 +1,130 @@
+// Topology.h
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "OkvsTool.h"
+#include "Paxos.h"
+#include "IoLoop.h"
+#include "MatchFilter.h"
+
+// 参与方的角色
+enum class PartyRole
+{
+    Owner,        // 数据拥有方：由 keys 生成 values，编码成 D 发给 parent
+    Relay,        // 中间节点：接收 fanIn 个 D，异或成一个 D 发给 parent
+    Aggregator    // 汇总方（树根）：接收 fanIn 个 D，异或后解码一次
+};
+
+// 参与方之间的传输方式
+enum class Transport
+{
+    Tcp,          // TCP，各方按 addr 连接（同一进程内运行时即走 loopback）
+    InProc        // 同一进程内的 socketpair，只能配合 all 模式使用
+};
+
+struct PartyConfig
+{
+    uint64_t id = 0;
+    PartyRole role = PartyRole::Owner;
+
+    // 中间节点/汇总方的地址：在 port 上监听所有网卡，其他参与方连接 host:port。
+    // 数据拥有方不需要。
+    std::string host = "127.0.0.1";
+    uint16_t port = 0;
+
+    // 数据拥有方/中间节点：D 的接收者
+    uint64_t parent = 0;
+
+    // 中间节点/汇总方：要接收的 D 个数，0 表示等于 parent 为本方的参与方个数
+    uint64_t fanIn = 0;
+
+    std::string keyPath = "../keys.csv";
+    std::string valPath;    // 数据拥有方：values 的二进制副本，留空则不写
+
+    // 数据拥有方：OkvsFile 格式的 D。文件存在时不再编码，直接用 sendfile 发出；
+    // 不存在时照常编码发送，之后写出该文件供下次使用
+    std::string okvsFile;
+};
+
+// 拓扑配置。格式为 ini 风格的文本：
+//
+//     bits      = 64          # 全局参数
+//     engine    = paxos       # paxos | baxos | band64 | band128 | band256 | band512
+//     transport = tcp         # tcp | inproc
+//     streams   = 4           # 每个 D 用几条并行连接发送
+//     zeroCopy  = 1           # 用 MSG_ZEROCOPY 发送内存中的 D
+//     io        = auto        # auto | uring | epoll
+//     bounded   = 1           # 中间节点与汇总方边收边异或，不保留各子节点的 D
+//     matchFile   = ../out/matches.csv  # 汇总方把 values 异或等于 matchTarget 的行写到此文件
+//     matchFormat = csv       # csv | binary
+//     matchTarget = 0         # 与之比较的值（block 的低 64 位，高位为 0）
+//
+//     [party 1]
+//     role   = owner
+//     parent = 3
+//     keys   = ../keys.csv
+//
+//     [party 3]
+//     role  = aggregator
+//     addr  = 172.24.122.108:9000
+//
+// '#' 之后为注释。全局的 keys 是之后各参与方 keys 的默认值。
+//
+// 也可以不写 [party] 段，而用 treeOwners / treeArity 自动生成 k 叉汇总树，
+// 见 buildTree。
+//
+// D 的异或只有在各方使用相同 PaxosParam 时才有意义：numItems 非 0 时
+// 所有参与方都按 numItems 构造 PaxosParam，否则按各自 keys 的个数。
+struct Topology
+{
+    int bits = 64;
+    uint64_t weight = 3;
+    uint64_t ssp = 40;
+    volePSI::PaxosParam::DenseType dt = volePSI::PaxosParam::GF128;
+    OkvsEngine engine = OkvsEngine::Paxos;
+    uint64_t seed = 0;
+    std::string rowCacheDir = "../okvs_cache";
+    Transport transport = Transport::Tcp;
+    uint64_t streams = 1;       // 每个 D 分几条并行连接发送（条带化）
+    bool zeroCopy = false;      // 内存中的 D 用 MSG_ZEROCOPY 发送
+    IoBackend io = IoBackend::Auto;
+    bool bounded = false;       // 收到的 D 经暂存区直接异或进一个累加矩阵（MatrixReceiver::foldInto）
+    std::string matchFile;      // 留空则汇总方只打印解码结果，不筛选
+    MatchFormat matchFormat = MatchFormat::Csv;
+    uint64_t matchTarget = 0;
+    uint64_t numItems = 0;
+    std::string keyPath = "../keys.csv";
+
+    // 自动生成汇总树的参数
+    uint64_t treeOwners = 0;
+    uint64_t treeArity = 2;
+    std::string treeHost = "127.0.0.1";
+    uint16_t basePort = 9000;
+
+    std::vector<PartyConfig> parties;
+
+    // 读取并校验配置文件
+    bool load(const std::string& path);
+
+    // 检查 id 唯一、parent 存在且能接收 D、每条链都通向一个汇总方（可以有多个）、
+    // fanIn 与实际子节点个数一致
+    bool validate();
+
+    // 生成 numOwners 个数据拥有方的 k 叉汇总树（k = arity >= 2）：数据拥有方
+    // 为叶子，每 arity 个节点挂在一个中间节点下，逐层向上，直到剩下不超过
+    // arity 个节点时挂到汇总方。id 依次为：数据拥有方 1..numOwners，各层
+    // 中间节点，最后是汇总方。中间节点和汇总方监听 treeHost:basePort+i。
+    // 无论参与方多少，每条边上只传一个 D。
+    bool buildTree(uint64_t numOwners, uint64_t arity);
+
+    // 从 id 到汇总方的边数的最大值
+    uint64_t depth() const;
+
+    const PartyConfig* find(uint64_t id) const;
+    PartyConfig* find(uint64_t id);
+
+    // parent 为 id 的参与方个数
+    uint64_t numChildren(uint64_t id) const;
+};
@@ -0,0 +1,381 @@
+// ValuePrf.cpp
+#include "ValuePrf.h"
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+#include <iomanip>
+
+#include <cpuid.h>
+#include <immintrin.h>
+#include <openssl/evp.h>
+
+#include <cryptoTools/Crypto/AES.h>
+#include <cryptoTools/Crypto/PRNG.h>
+
+using namespace std;
+using namespace osuCrypto;
+
+namespace
+{
+    const uint32_t gSha256K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2 };
+
+    const uint32_t gSha256H0[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+    inline uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+    inline uint32_t loadBe32(const uint8_t* p)
+    {
+        uint32_t v;
+        memcpy(&v, p, 4);
+        return __builtin_bswap32(v);
+    }
+
+    // secret || key 只有 32 字节，补位后正好一个 64 字节分组：
+    // [secret 16][key 16][0x80][0 ...][长度 256 位，大端]
+    inline void buildMessage(const block& secret, const block& key, uint8_t msg[64])
+    {
+        memset(msg, 0, 64);
+        memcpy(msg, &secret, 16);
+        memcpy(msg + 16, &key, 16);
+        msg[32] = 0x80;
+        msg[62] = 0x01;
+    }
+
+    // 摘要前 8 字节按小端解释为 u64（与旧实现的 memcpy 一致）
+    inline block digestToValue(uint32_t h0, uint32_t h1)
+    {
+        uint64_t v = uint64_t(__builtin_bswap32(h0)) | (uint64_t(__builtin_bswap32(h1)) << 32);
+        return toBlock(v);
+    }
+
+    // ---------------- 标量 ----------------
+
+    void sha256Scalar1(const block& secret, const block* keys, block* vals)
+    {
+        uint8_t msg[64];
+        buildMessage(secret, *keys, msg);
+
+        uint32_t w[64];
+        for (int i = 0; i < 16; ++i)
+            w[i] = loadBe32(msg + 4 * i);
+        for (int i = 16; i < 64; ++i) {
+            uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+
+        uint32_t a = gSha256H0[0], b = gSha256H0[1], c = gSha256H0[2], d = gSha256H0[3];
+        uint32_t e = gSha256H0[4], f = gSha256H0[5], g = gSha256H0[6], h = gSha256H0[7];
+        for (int i = 0; i < 64; ++i) {
+            uint32_t S1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+            uint32_t ch = (e & f) ^ (~e & g);
+            uint32_t t1 = h + S1 + ch + gSha256K[i] + w[i];
+            uint32_t S0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+            uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+            uint32_t t2 = S0 + maj;
+            h = g; g = f; f = e; e = d + t1;
+            d = c; c = b; b = a; a = t1 + t2;
+        }
+
+        *vals = digestToValue(gSha256H0[0] + a, gSha256H0[1] + b);
+    }
+
+    // ---------------- SHA-NI，一次一个 ----------------
+
+    __attribute__((target("sha,sse4.1,ssse3")))
+    void sha256Ni1(const block& secret, const block* keys, block* vals)
+    {
+        alignas(16) uint8_t msg[64];
+        buildMessage(secret, *keys, msg);
+
+        const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+        // 状态按 ABEF / CDGH 排列
+        __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(gSha256H0)), 0xB1);
+        __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(gSha256H0 + 4)), 0x1B);
+        __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+        state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+        const __m128i abefSave = state0, cdghSave = state1;
+
+        __m128i m[4];
+        for (int g = 0; g < 16; ++g) {
+            __m128i& cur = m[g & 3];
+            if (g < 4)
+                cur = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(msg + 16 * g)), mask);
+
+            __m128i k = _mm_loadu_si128(reinterpret_cast<const __m128i*>(gSha256K + 4 * g));
+            __m128i wk = _mm_add_epi32(cur, k);
+            state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+
+            // 提前算出后面分组的消息调度
+            if (g >= 3 && g < 15) {
+                __m128i& next = m[(g + 1) & 3];
+                next = _mm_add_epi32(next, _mm_alignr_epi8(cur, m[(g - 1) & 3], 4));
+                next = _mm_sha256msg2_epu32(next, cur);
+            }
+
+            wk = _mm_shuffle_epi32(wk, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, wk);
+
+            if (g >= 1 && g < 13)
+                m[(g - 1) & 3] = _mm_sha256msg1_epu32(m[(g - 1) & 3], cur);
+        }
+
+        state0 = _mm_add_epi32(state0, abefSave);
+        state1 = _mm_add_epi32(state1, cdghSave);
+
+        // ABEF/CDGH -> ABCD/EFGH，只需要 A、B
+        tmp = _mm_shuffle_epi32(state0, 0x1B);
+        state1 = _mm_shuffle_epi32(state1, 0xB1);
+        state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+
+        alignas(16) uint32_t out[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(out), state0);
+        *vals = digestToValue(out[0], out[1]);
+    }
+
+    // ---------------- AVX2 八路 ----------------
+
+#define AVX2_FN __attribute__((target("avx2")))
+
+    AVX2_FN inline __m256i rotr8(__m256i x, int n)
+    {
+        return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+    }
+
+    AVX2_FN void sha256Avx2x8(const block& secret, const block* keys, block* vals)
+    {
+        // w[0..3] 是 secret，w[8..15] 是补位，只有 w[4..7] 随 key 变化
+        uint8_t msg[64];
+        buildMessage(secret, keys[0], msg);
+
+        __m256i w[16];
+        for (int i = 0; i < 16; ++i)
+            w[i] = _mm256_set1_epi32(loadBe32(msg + 4 * i));
+
+        alignas(32) uint32_t kw[4][8];
+        for (int lane = 0; lane < 8; ++lane) {
+            auto p = reinterpret_cast<const uint8_t*>(&keys[lane]);
+            for (int j = 0; j < 4; ++j)
+                kw[j][lane] = loadBe32(p + 4 * j);
+        }
+        for (int j = 0; j < 4; ++j)
+            w[4 + j] = _mm256_load_si256(reinterpret_cast<const __m256i*>(kw[j]));
+
+        __m256i a = _mm256_set1_epi32(gSha256H0[0]), b = _mm256_set1_epi32(gSha256H0[1]);
+        __m256i c = _mm256_set1_epi32(gSha256H0[2]), d = _mm256_set1_epi32(gSha256H0[3]);
+        __m256i e = _mm256_set1_epi32(gSha256H0[4]), f = _mm256_set1_epi32(gSha256H0[5]);
+        __m256i g = _mm256_set1_epi32(gSha256H0[6]), h = _mm256_set1_epi32(gSha256H0[7]);
+
+        for (int i = 0; i < 64; ++i) {
+            // 消息调度放在 16 项的环形缓冲里
+            __m256i wi;
+            if (i < 16) {
+                wi = w[i];
+            } else {
+                __m256i w15 = w[(i - 15) & 15], w2 = w[(i - 2) & 15];
+                __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(rotr8(w15, 7), rotr8(w15, 18)), _mm256_srli_epi32(w15, 3));
+                __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(rotr8(w2, 17), rotr8(w2, 19)), _mm256_srli_epi32(w2, 10));
+                wi = _mm256_add_epi32(_mm256_add_epi32(w[i & 15], s0), _mm256_add_epi32(w[(i - 7) & 15], s1));
+                w[i & 15] = wi;
+            }
+
+            __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(rotr8(e, 6), rotr8(e, 11)), rotr8(e, 25));
+            __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+            __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, S1),
+                _mm256_add_epi32(_mm256_add_epi32(ch, _mm256_set1_epi32(gSha256K[i])), wi));
+            __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(rotr8(a, 2), rotr8(a, 13)), rotr8(a, 22));
+            __m256i maj = _mm256_xor_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_xor_si256(a, b)));
+            __m256i t2 = _mm256_add_epi32(S0, maj);
+
+            h = g; g = f; f = e; e = _mm256_add_epi32(d, t1);
+            d = c; c = b; b = a; a = _mm256_add_epi32(t1, t2);
+        }
+
+        alignas(32) uint32_t ha[8], hb[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(ha), _mm256_add_epi32(a, _mm256_set1_epi32(gSha256H0[0])));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(hb), _mm256_add_epi32(b, _mm256_set1_epi32(gSha256H0[1])));
+        for (int lane = 0; lane < 8; ++lane)
+            vals[lane] = digestToValue(ha[lane], hb[lane]);
+    }
+
+#undef AVX2_FN
+
+    enum class ShaBackend { Scalar, Avx2x8, ShaNi };
+
+    ShaBackend detectShaBackend()
+    {
+        unsigned eax, ebx, ecx, edx;
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & (1u << 29)) &&
+            __builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("ssse3"))
+            return ShaBackend::ShaNi;
+        if (__builtin_cpu_supports("avx2"))
+            return ShaBackend::Avx2x8;
+        return ShaBackend::Scalar;
+    }
+
+    ShaBackend shaBackend()
+    {
+        static const ShaBackend backend = detectShaBackend();
+        return backend;
+    }
+
+    // 单线程处理 [keys, keys + n)
+    void deriveRange(const block* keys, block* vals, size_t n, const block& secret, ValuePrf prf, ShaBackend backend)
+    {
+        size_t i = 0;
+        if (prf == ValuePrf::Aes) {
+            oc::AES aes(secret);
+            for (; i < n; i += 32)
+                aes.hashBlocks(keys + i, std::min<size_t>(32, n - i), vals + i);
+            return;
+        }
+
+        switch (backend) {
+        case ShaBackend::ShaNi:
+            for (; i < n; ++i)
+                sha256Ni1(secret, keys + i, vals + i);
+            break;
+        case ShaBackend::Avx2x8:
+            for (; i + 8 <= n; i += 8)
+                sha256Avx2x8(secret, keys + i, vals + i);
+            for (; i < n; ++i)
+                sha256Scalar1(secret, keys + i, vals + i);
+            break;
+        default:
+            for (; i < n; ++i)
+                sha256Scalar1(secret, keys + i, vals + i);
+        }
+    }
+
+    void deriveValuesWith(oc::span<const block> keys, oc::span<block> vals, const block& secret,
+        ValuePrf prf, size_t numThreads, ShaBackend backend)
+    {
+        if (keys.size() != vals.size())
+            throw std::runtime_error("deriveValues: keys and vals size mismatch " LOCATION);
+
+        if (numThreads == 0)
+            numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        // 每个线程至少 4096 个 key，段边界按 32 对齐
+        numThreads = std::max<size_t>(1, std::min<size_t>(numThreads, keys.size() / 4096));
+
+        auto routine = [&](size_t t) {
+            size_t begin = (keys.size() * t / numThreads) / 32 * 32;
+            size_t end = t + 1 == numThreads ? keys.size() : (keys.size() * (t + 1) / numThreads) / 32 * 32;
+            deriveRange(keys.data() + begin, vals.data() + begin, end - begin, secret, prf, backend);
+        };
+
+        vector<std::thread> thrds(numThreads - 1);
+        for (size_t t = 0; t < thrds.size(); ++t)
+            thrds[t] = std::thread(routine, t);
+        routine(thrds.size());
+        for (auto& th : thrds)
+            th.join();
+    }
+}
+
+void deriveValues(
+    oc::span<const block> keys,
+    oc::span<block> vals,
+    const block& secret,
+    ValuePrf prf,
+    size_t numThreads)
+{
+    deriveValuesWith(keys, vals, secret, prf, numThreads, shaBackend());
+}
+
+block valuePrfReference(const block& key, const block& secret)
+{
+    uint8_t buf[32]; // SHA256 输出
+    unsigned int len = 0;
+
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx) throw std::runtime_error("EVP_MD_CTX_new failed");
+
+    if (EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr) != 1 ||
+        EVP_DigestUpdate(ctx, &secret, sizeof(block)) != 1 ||
+        EVP_DigestUpdate(ctx, &key, sizeof(block)) != 1 ||
+        EVP_DigestFinal_ex(ctx, buf, &len) != 1) {
+        EVP_MD_CTX_free(ctx);
+        throw std::runtime_error("EVP SHA256 failed");
+    }
+    EVP_MD_CTX_free(ctx);
+
+    // 取前 8 字节得到 uint64_t
+    uint64_t val;
+    memcpy(&val, buf, sizeof(uint64_t));
+    return toBlock(val);
+}
+
+const char* sha256ValueBackend()
+{
+    switch (shaBackend()) {
+    case ShaBackend::ShaNi:  return "sha-ni";
+    case ShaBackend::Avx2x8: return "avx2x8";
+    default:                 return "scalar";
+    }
+}
+
+void benchValuePrf(size_t n, size_t numThreads)
+{
+    block secret = oc::toBlock(0x12345678, 0x90abcdef);
+    vector<block> keys(n), vals(n), ref(n);
+    oc::PRNG prng(oc::ZeroBlock);
+    for (size_t i = 0; i < n; ++i)
+        keys[i] = toBlock(prng.get<uint64_t>());
+
+    auto time = [&](const char* name, auto&& fn) {
+        auto start = chrono::steady_clock::now();
+        fn();
+        double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "  " << std::left << std::setw(22) << name
+             << n / sec / 1e6 << " M keys/s (" << sec * 1000 << " ms)" << endl;
+    };
+
+    cout << "value PRF, n = " << n << ", threads = " << numThreads << endl;
+    time("EVP per key (old)", [&] {
+        for (size_t i = 0; i < n; ++i)
+            ref[i] = valuePrfReference(keys[i], secret);
+    });
+
+    auto check = [&](const char* name) {
+        if (memcmp(vals.data(), ref.data(), n * sizeof(block)) != 0)
+            cout << "  " << name << " does not match the EVP values!" << endl;
+    };
+
+    time("sha256 scalar", [&] {
+        deriveValuesWith(keys, vals, secret, ValuePrf::Sha256, numThreads, ShaBackend::Scalar);
+    });
+    check("sha256 scalar");
+
+    if (__builtin_cpu_supports("avx2")) {
+        time("sha256 avx2x8", [&] {
+            deriveValuesWith(keys, vals, secret, ValuePrf::Sha256, numThreads, ShaBackend::Avx2x8);
+        });
+        check("sha256 avx2x8");
+    }
+
+    if (shaBackend() == ShaBackend::ShaNi) {
+        time("sha256 sha-ni", [&] {
+            deriveValuesWith(keys, vals, secret, ValuePrf::Sha256, numThreads, ShaBackend::ShaNi);
+        });
+        check("sha256 sha-ni");
+    }
+
+    time("aes", [&] {
+        deriveValues(keys, vals, secret, ValuePrf::Aes, numThreads);
+    });
+}
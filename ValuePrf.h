@@ -0,0 +1,33 @@
+// ValuePrf.h
+#pragma once
+
+#include <cstddef>
+#include <cryptoTools/Common/Defines.h>
+
+using osuCrypto::block;
+
+// 由 key 派生 value 的 PRF
+enum class ValuePrf
+{
+    Aes,        // 固定密钥 AES：value = AES_secret(key) ^ key，默认
+    Sha256      // SHA-256(secret || key) 的前 8 字节，与最初的 EVP 实现逐位一致
+};
+
+// vals[i] = PRF(secret, keys[i])。keys 被切成 numThreads 段并行计算，每段内
+// AES 每批 32 个，SHA-256 每批 8 个（SHA-NI 或 AVX2 八路，运行时选择，否则用标量）。
+// numThreads = 0 表示使用所有核。
+void deriveValues(
+    oc::span<const block> keys,
+    oc::span<block> vals,
+    const block& secret,
+    ValuePrf prf = ValuePrf::Aes,
+    size_t numThreads = 0);
+
+// 旧的逐 key 实现：每个 key 新建一个 EVP_MD_CTX 计算 SHA-256。仅用于校验和基准。
+block valuePrfReference(const block& key, const block& secret);
+
+// 当前机器上 Sha256 使用的实现："sha-ni"、"avx2x8" 或 "scalar"
+const char* sha256ValueBackend();
+
+// 基准：n 个 key 下各实现的 keys/s，同时校验 Sha256 与参考实现一致
+void benchValuePrf(size_t n, size_t numThreads);
@@ -0,0 +1,315 @@
+#include "VolePool.h"
+#include <cstring>
+#include <cerrno>
+#include <memory>
+#include <utility>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace volePSI
+{
+	struct VolePool::Header
+	{
+		char mMagic[8];
+		u64 mVersion;
+		u64 mRole;
+		u64 mEntrySize;
+		u64 mCapacity;
+		u64 mMalicious;
+		// entries [mHead, mTail) are available. Both count every entry ever produced,
+		// the slot of entry i is i % mCapacity.
+		u64 mHead;
+		u64 mTail;
+	};
+
+	struct VolePool::SlotHeader
+	{
+		block mTag;
+		block mD;
+		u64 mSize;
+		u64 mReserved;
+	};
+
+	static const char volePoolMagic[8] = { 'V', 'O', 'L', 'E', 'P', 'O', 'O', 'L' };
+
+	VolePool::~VolePool()
+	{
+		if (mMap)
+			munmap(mMap, mMapBytes);
+		if (mFd != -1)
+			close(mFd);
+	}
+
+	VolePool::Header& VolePool::header()
+	{
+		return *(Header*)mMap;
+	}
+
+	VolePool::SlotHeader& VolePool::slot(u64 idx)
+	{
+		return *(SlotHeader*)(mMap + sizeof(Header) + (idx % mCapacity) * mSlotBytes);
+	}
+
+	block* VolePool::slotData(u64 idx)
+	{
+		return (block*)(&slot(idx) + 1);
+	}
+
+	void VolePool::init(Role role, u64 entrySize, u64 capacity, const std::string& path, bool malicious)
+	{
+		static_assert(sizeof(Header) % sizeof(block) == 0 && sizeof(SlotHeader) % sizeof(block) == 0, "VolePool layout");
+
+		if (mMap)
+			throw std::runtime_error("VolePool: already initialized. " LOCATION);
+		if (entrySize == 0 || capacity == 0)
+			throw std::runtime_error("VolePool: entrySize and capacity must be non-zero. " LOCATION);
+		if (capacity < 2)
+			throw std::runtime_error("VolePool: capacity must be at least 2 so that an entry can be produced while another is in use. " LOCATION);
+
+		mRole = role;
+		mEntrySize = entrySize;
+		mCapacity = capacity;
+		mMalicious = malicious;
+		mSlotBytes = sizeof(SlotHeader) + entrySize * sizeof(block) * (role == Role::Receiver ? 2 : 1);
+		mMapBytes = sizeof(Header) + capacity * mSlotBytes;
+
+		bool fresh = true;
+		void* map = MAP_FAILED;
+		if (path.empty())
+		{
+			map = mmap(nullptr, mMapBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		}
+		else
+		{
+			mFd = open(path.c_str(), O_RDWR | O_CREAT, 0600);
+			struct stat st;
+			if (mFd == -1 || fstat(mFd, &st))
+				throw std::runtime_error("VolePool: can not open " + path + ": " + strerror(errno) + " " LOCATION);
+
+			fresh = u64(st.st_size) != mMapBytes;
+			if (fresh && ftruncate(mFd, mMapBytes))
+				throw std::runtime_error("VolePool: can not resize " + path + ": " + strerror(errno) + " " LOCATION);
+			map = mmap(nullptr, mMapBytes, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+		}
+		if (map == MAP_FAILED)
+			throw std::runtime_error(std::string("VolePool: mmap failed: ") + strerror(errno) + " " LOCATION);
+		mMap = (u8*)map;
+
+		auto& h = header();
+		if (!fresh)
+		{
+			fresh =
+				memcmp(h.mMagic, volePoolMagic, sizeof(volePoolMagic)) ||
+				h.mVersion != 2 ||
+				h.mRole != u64(role) ||
+				h.mEntrySize != entrySize ||
+				h.mCapacity != capacity ||
+				h.mMalicious != u64(malicious) ||
+				h.mHead > h.mTail ||
+				h.mTail - h.mHead > capacity;
+		}
+
+		if (fresh)
+		{
+			memcpy(h.mMagic, volePoolMagic, sizeof(volePoolMagic));
+			h.mVersion = 2;
+			h.mRole = u64(role);
+			h.mEntrySize = entrySize;
+			h.mCapacity = capacity;
+			h.mMalicious = malicious;
+			h.mHead = 0;
+			h.mTail = 0;
+		}
+
+		// entries that were taken by an earlier process are never handed out again.
+		mFreed = h.mHead;
+		mLeased = false;
+	}
+
+	VolePool::Lease::Lease(Lease&& o) noexcept
+		: mEntry(o.mEntry)
+		, mPool(std::exchange(o.mPool, nullptr))
+	{}
+
+	VolePool::Lease& VolePool::Lease::operator=(Lease&& o) noexcept
+	{
+		if (this != &o)
+		{
+			reset();
+			mEntry = o.mEntry;
+			mPool = std::exchange(o.mPool, nullptr);
+		}
+		return *this;
+	}
+
+	void VolePool::Lease::reset()
+	{
+		if (mPool)
+			std::exchange(mPool, nullptr)->release();
+		mEntry.mA = mEntry.mB = mEntry.mC = {};
+	}
+
+	Proto VolePool::produce(u64 count, PRNG& prng, Socket& chl)
+	{
+		auto i = u64{ 0 };
+		auto idx = u64{ 0 };
+		auto d = block{};
+		auto tag = block{};
+		auto sender = std::unique_ptr<oc::SilentVoleSender<block, block, oc::CoeffCtxGF128>>{};
+		auto recver = std::unique_ptr<oc::SilentVoleReceiver<block, block, oc::CoeffCtxGF128>>{};
+
+		if (!mMap)
+			throw std::runtime_error("VolePool: not initialized. " LOCATION);
+
+		{
+			std::lock_guard<std::mutex> lock(mMtx);
+			if (header().mTail - mFreed + count > mCapacity)
+				throw std::runtime_error("VolePool: no free slot for " + std::to_string(count) +
+					" entries, call waitFree() first. " LOCATION);
+			idx = header().mTail;
+		}
+
+		for (i = 0; i < count; ++i, ++idx)
+		{
+			// the sender draws a random tag for the correlation. Both pools store it
+			// and the OPRF checks that both parties took the same correlation.
+			if (mRole == Role::Sender)
+			{
+				tag = prng.get();
+				co_await(chl.send(std::move(tag)));
+
+				sender.reset(new oc::SilentVoleSender<block, block, oc::CoeffCtxGF128>);
+				sender->mMultType = mMultType;
+				if (mMalicious)
+					sender->mMalType = oc::SilentSecType::Malicious;
+				if (mReducedRounds)
+					sender->configure(mEntrySize, oc::SilentBaseType::Base);
+
+				d = prng.get();
+				co_await(sender->silentSendInplace(d, mEntrySize, prng, chl));
+				memcpy(slotData(idx), sender->mB.data(), mEntrySize * sizeof(block));
+			}
+			else
+			{
+				co_await(chl.recv(tag));
+
+				recver.reset(new oc::SilentVoleReceiver<block, block, oc::CoeffCtxGF128>);
+				recver->mMultType = mMultType;
+				if (mMalicious)
+					recver->mMalType = oc::SilentSecType::Malicious;
+				if (mReducedRounds)
+					recver->configure(mEntrySize, oc::SilentBaseType::Base);
+
+				d = oc::ZeroBlock;
+				co_await(recver->silentReceiveInplace(mEntrySize, prng, chl));
+				memcpy(slotData(idx), recver->mA.data(), mEntrySize * sizeof(block));
+				memcpy(slotData(idx) + mEntrySize, recver->mC.data(), mEntrySize * sizeof(block));
+			}
+
+			slot(idx).mTag = tag;
+			slot(idx).mSize = mEntrySize;
+			slot(idx).mD = d;
+
+			{
+				std::lock_guard<std::mutex> lock(mMtx);
+				header().mTail = idx + 1;
+			}
+			mCv.notify_all();
+		}
+	}
+
+	VolePool::Lease VolePool::take(u64 size)
+	{
+		if (size > mEntrySize)
+			throw std::runtime_error("VolePool: requested " + std::to_string(size) +
+				" correlations but entries have " + std::to_string(mEntrySize) + ". " LOCATION);
+
+		auto idx = u64{ 0 };
+		Lease lease;
+		{
+			std::lock_guard<std::mutex> lock(mMtx);
+			if (mLeased)
+				throw std::runtime_error("VolePool: the previous entry was not released. " LOCATION);
+			if (header().mHead == header().mTail)
+				throw std::runtime_error("VolePool: empty, call waitAvailable() first. " LOCATION);
+
+			idx = header().mHead++;
+			mLeased = true;
+			lease.mPool = this;
+		}
+
+		// the entry must be gone from the file before anyone uses it. If the sync
+		// fails the lease is dropped and the entry stays consumed.
+		if (mFd != -1 && msync(mMap, sizeof(Header), MS_SYNC))
+			throw std::runtime_error(std::string("VolePool: msync failed: ") + strerror(errno) + " " LOCATION);
+
+		auto& e = lease.mEntry;
+		e.mTag = slot(idx).mTag;
+		e.mD = slot(idx).mD;
+		if (mRole == Role::Sender)
+			e.mB = span<block>(slotData(idx), mEntrySize);
+		else
+		{
+			e.mA = span<block>(slotData(idx), mEntrySize);
+			e.mC = span<block>(slotData(idx) + mEntrySize, mEntrySize);
+		}
+		return lease;
+	}
+
+	void VolePool::release()
+	{
+		// the leased slot is mFreed, produce() does not touch it until mFreed moves on.
+		auto& s = slot(mFreed);
+		s.mTag = oc::ZeroBlock;
+		s.mD = oc::ZeroBlock;
+		memset(slotData(mFreed), 0, mSlotBytes - sizeof(SlotHeader));
+
+		{
+			std::lock_guard<std::mutex> lock(mMtx);
+			++mFreed;
+			mLeased = false;
+		}
+		mCv.notify_all();
+	}
+
+	u64 VolePool::available()
+	{
+		std::lock_guard<std::mutex> lock(mMtx);
+		return header().mTail - header().mHead;
+	}
+
+	void VolePool::waitAvailable(u64 n)
+	{
+		if (n > mCapacity)
+			throw std::runtime_error("VolePool: can not wait for more entries than the capacity. " LOCATION);
+
+		std::unique_lock<std::mutex> lock(mMtx);
+		auto ready = [&] { return header().mTail - header().mHead >= n; };
+		mCv.wait(lock, [&] { return ready() || !mAborted.empty(); });
+		if (!ready())
+			throw std::runtime_error("VolePool: " + mAborted + " " LOCATION);
+	}
+
+	void VolePool::waitFree(u64 n)
+	{
+		if (n > mCapacity)
+			throw std::runtime_error("VolePool: can not wait for more free slots than the capacity. " LOCATION);
+
+		std::unique_lock<std::mutex> lock(mMtx);
+		auto ready = [&] { return mCapacity - (header().mTail - mFreed) >= n; };
+		mCv.wait(lock, [&] { return ready() || !mAborted.empty(); });
+		if (!ready())
+			throw std::runtime_error("VolePool: " + mAborted + " " LOCATION);
+	}
+
+	void VolePool::abort(const std::string& reason)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMtx);
+			mAborted = reason.empty() ? "aborted" : reason;
+		}
+		mCv.notify_all();
+	}
+}
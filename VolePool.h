@@ -0,0 +1,133 @@
+#pragma once
+#include "Defines.h"
+#include <string>
+#include <mutex>
+#include <condition_variable>
+#include "libOTe/Vole/Silent/SilentVoleSender.h"
+#include "libOTe/Vole/Silent/SilentVoleReceiver.h"
+
+namespace volePSI
+{
+	// A pool of VOLE correlations generated ahead of time, so that an OPRF session
+	// does not have to run silent VOLE online. Each entry is an independent
+	// correlation a + b = c * d of length entrySize. The sender's pool holds (d, b),
+	// and the receiver's pool holds (a, c). Both pools are filled by the same runs
+	// of produce(), so entry i of the two pools belongs to one correlation. They are
+	// consumed in the same order, and each correlation carries a random tag that
+	// both pools store and the OPRF compares.
+	//
+	// Entries are stored in a ring of capacity slots. The ring is either anonymous
+	// memory or a file that is mmapped and reopened by a later process, which then
+	// continues with the entries that were produced but not yet taken. An entry is
+	// used once: take() removes it from the pool for good, and its slot is wiped and
+	// reused once the lease returned by take() is released. For a file-backed pool
+	// take() syncs the header to the file before it returns, so an entry that was
+	// handed out is not handed out again by a later process, even after a crash.
+	//
+	// produce() and take() never block, since they run inside coroutines. The
+	// caller waits for room or entries beforehand with waitFree() / waitAvailable()
+	// on a thread that does not drive a protocol. A pool has a single producer:
+	// produce() must not run concurrently with another produce() on the same pool,
+	// since it writes the slots after the tail without holding the lock.
+	class VolePool
+	{
+	public:
+		enum class Role : u64 { Sender = 0, Receiver = 1 };
+
+		struct Entry
+		{
+			block mTag = oc::ZeroBlock;
+			// sender: the VOLE delta.
+			block mD = oc::ZeroBlock;
+			// sender: b. receiver: a and c.
+			span<block> mB, mA, mC;
+		};
+
+		// the entry returned by take(). Its slot is freed when the lease is reset or
+		// destroyed, which includes a session that failed while it held the lease.
+		// The entry counts as consumed either way and is never handed out again.
+		// After reset() only the tag and d of the entry remain readable.
+		class Lease
+		{
+		public:
+			Lease() = default;
+			Lease(const Lease&) = delete;
+			Lease(Lease&& o) noexcept;
+			Lease& operator=(Lease&& o) noexcept;
+			~Lease() { reset(); }
+
+			const Entry& operator*() const { return mEntry; }
+			const Entry* operator->() const { return &mEntry; }
+
+			void reset();
+
+		private:
+			friend class VolePool;
+			Entry mEntry;
+			VolePool* mPool = nullptr;
+		};
+
+		oc::MultType mMultType = oc::DefaultMultType;
+		bool mReducedRounds = false;
+
+		VolePool() = default;
+		VolePool(const VolePool&) = delete;
+		~VolePool();
+
+		// path empty: the pool lives in anonymous memory. Otherwise it lives in the file
+		// at path. An existing file created with the same parameters is reopened with
+		// its entries, and any other file is overwritten. capacity must be at least 2.
+		void init(Role role, u64 entrySize, u64 capacity, const std::string& path = {}, bool malicious = false);
+
+		// runs count silent VOLEs with the peer's pool over chl and stores the results.
+		// Throws if fewer than count slots are free. The peer must call produce with
+		// the same count. Only one produce() may run on a pool at a time.
+		Proto produce(u64 count, PRNG& prng, Socket& chl);
+
+		// removes the next entry from the pool. Throws if the pool is empty, if the
+		// entries are smaller than size blocks, or if the previous lease was not
+		// released.
+		Lease take(u64 size);
+
+		// the number of entries that were produced and not yet taken.
+		u64 available();
+
+		// blocks until at least n entries are available.
+		void waitAvailable(u64 n);
+
+		// blocks until at least n slots are free for produce().
+		void waitFree(u64 n);
+
+		// called by the producer when produce() failed. Every current and later
+		// waitAvailable() / waitFree() that can not be satisfied right away throws
+		// with reason instead of waiting for entries that will never come.
+		void abort(const std::string& reason);
+
+		u64 entrySize() const { return mEntrySize; }
+		bool malicious() const { return mMalicious; }
+
+	private:
+		struct Header;
+		struct SlotHeader;
+
+		Role mRole = Role::Sender;
+		u64 mEntrySize = 0, mCapacity = 0, mSlotBytes = 0, mMapBytes = 0;
+		bool mMalicious = false;
+		u8* mMap = nullptr;
+		int mFd = -1;
+
+		std::mutex mMtx;
+		std::condition_variable mCv;
+		// slots [mFreed, mHead) are taken but not yet released.
+		u64 mFreed = 0;
+		bool mLeased = false;
+		std::string mAborted;
+
+		// wipes and frees the slot of the leased entry.
+		void release();
+
+		Header& header();
+		SlotHeader& slot(u64 idx);
+		block* slotData(u64 idx);
+	};
+}
@@ -2,6 +2,7 @@
 #include <iomanip>
 #include <vector>
 #include <chrono>
+#include <thread>
 #include <libOTe/Tools/LDPC/Mtx.h>
 #include <libOTe/Tools/LDPC/Util.h>
 #include <libOTe_Tests/Common.h>
@@ -15,6 +16,10 @@
 #include "SimpleIndex.h"
 #include "RsPsi.h"
 #include "RsOprf.h"
+#include "VolePool.h"
+#include "BandOkvs.h"
+#include "ValuePrf.h"
+#include "MatchFilter.h"
 #include <libdivide.h>
 using namespace oc;
 using namespace volePSI;;
@@ -77,8 +82,9 @@ void perfPaxosImpl(oc::CLP& cmd)
 	auto ssp = cmd.getOr("ssp", 40);
 	auto dt = cmd.isSet("binary") ? PaxosParam::Binary : PaxosParam::GF128;
 	auto cols = cmd.getOr("cols", 0);
+	auto mode = cmd.isSet("fastRange") ? PaxosHashMode::FastRange : PaxosHashMode::LibDivide;
 
-	PaxosParam pp(n, w, ssp, dt);
+	PaxosParam pp(n, w, ssp, dt, mode);
 	//std::cout << "e=" << pp.size() / double(n) << std::endl;
 	if (maxN < pp.size())
 	{
@@ -156,6 +162,50 @@ void perfPaxos(oc::CLP& cmd)
 
 }
 
+void perfBand(oc::CLP& cmd)
+{
+	auto n = cmd.getOr("n", 1ull << cmd.getOr("nn", 10));
+	auto t = cmd.getOr("t", 1ull);
+	auto v = cmd.getOr("v", cmd.isSet("v") ? 1 : 0);
+	auto w = cmd.getOr("bw", 512);
+	auto ssp = cmd.getOr("ssp", 40);
+
+	BandParam bp(n, w, ssp);
+	if (cmd.hasValue("eps"))
+		bp.init(n, w, ssp, cmd.get<double>("eps"));
+
+	std::vector<block> key(n), val(n), pax(bp.size());
+	PRNG prng(ZeroBlock);
+	prng.get<block>(key);
+	prng.get<block>(val);
+
+	Timer timer;
+	auto start = timer.setTimePoint("start");
+	auto end = start;
+	for (u64 i = 0; i < t; ++i)
+	{
+		BandOkvs okvs;
+		okvs.init(n, bp, block(i, i));
+
+		if (v > 1)
+			okvs.setTimer(timer);
+
+		okvs.solve<block>(key, oc::span<block>(val), oc::span<block>(pax));
+		timer.setTimePoint("s" + std::to_string(i));
+		okvs.decode<block>(key, oc::span<block>(val), oc::span<block>(pax));
+
+		end = timer.setTimePoint("d" + std::to_string(i));
+	}
+
+	if (v)
+		std::cout << timer << std::endl;
+
+	auto tt = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / double(1000);
+	std::cout << "total " << tt << "ms, e=" << double(bp.size()) / n << std::endl;
+	double D_size_MB = (bp.size() * sizeof(block)) / (1024.0 * 1024.0);
+	std::cout << "D vector size: " << D_size_MB << " MB" << std::endl;
+}
+
 void perfOPRF(oc::CLP& cmd)
 {
     // 基本参数设置（从perfPSI中提取）
@@ -196,6 +246,75 @@ void perfOPRF(oc::CLP& cmd)
     // 设置VOLE类型
     oprfRecv.setMultType(type);
     oprfSend.setMultType(type);
+
+    // 离线 VOLE 池（-pool）：后台线程先生成 t 份相关性，之后的计时只含在线部分，
+    // 即 Baxos 求解和双方各一条消息。-poolFile 时池放在 <path>.send / <path>.recv
+    // 中，下次运行接着使用其中未取用的相关性
+    bool usePool = cmd.isSet("pool");
+    VolePool sendPool, recvPool;
+    auto poolSockets = cp::LocalAsyncSocket::makePair();
+    PRNG sendPoolPrng(oc::sysRandomSeed()), recvPoolPrng(oc::sysRandomSeed());
+    std::thread producer;
+    // 后台生成失败时 waitAvailable 抛出，此时生成线程已退出
+    auto waitPools = [&](u64 k) {
+        try {
+            sendPool.waitAvailable(k);
+            recvPool.waitAvailable(k);
+            return true;
+        } catch (std::exception& e) {
+            std::cout << "VOLE pool: " << e.what() << std::endl;
+            producer.join();
+            return false;
+        }
+    };
+    if (usePool) {
+        auto entrySize = oprfVoleSize(n, oprfRecv.mBinSize, oprfRecv.mSsp);
+        u64 capacity = cmd.getOr("poolSize", std::max<u64>(t, 2));
+        auto path = cmd.getOr<std::string>("poolFile", "");
+        sendPool.mMultType = type;
+        recvPool.mMultType = type;
+        sendPool.init(VolePool::Role::Sender, entrySize, capacity, path.empty() ? path : path + ".send");
+        recvPool.init(VolePool::Role::Receiver, entrySize, capacity, path.empty() ? path : path + ".recv");
+        if (sendPool.available() != recvPool.available()) {
+            std::cout << "VOLE pool files hold " << sendPool.available() << " and " << recvPool.available()
+                      << " entries; delete them and rerun" << std::endl;
+            return;
+        }
+
+        // 两个池必须生成同样多的相关性；容量不足 t 时后面的试验会等待后台生成。
+        // produce/take 不会阻塞，等待空槽和等待相关性都在普通线程上做
+        u64 ready = std::min<u64>(t, capacity);
+        u64 need = t > sendPool.available() ? t - sendPool.available() : 0;
+        auto offlineStart = std::chrono::high_resolution_clock::now();
+        producer = std::thread([&, need] {
+            for (u64 j = 0; j < need; ++j) {
+                sendPool.waitFree(1);
+                recvPool.waitFree(1);
+                auto r = macoro::sync_wait(macoro::when_all_ready(
+                    sendPool.produce(1, sendPoolPrng, poolSockets[1]),
+                    recvPool.produce(1, recvPoolPrng, poolSockets[0])));
+                try {
+                    std::get<0>(r).result();
+                    std::get<1>(r).result();
+                } catch (std::exception& e) {
+                    std::cout << "VOLE pool producer error: " << e.what() << std::endl;
+                    // 让等待相关性的试验循环退出，而不是一直等下去
+                    sendPool.abort("the producer failed");
+                    recvPool.abort("the producer failed");
+                    return;
+                }
+            }
+        });
+        if (!waitPools(ready))
+            return;
+        auto offlineMs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::high_resolution_clock::now() - offlineStart).count() / 1000.0;
+        std::cout << "Offline: " << ready << " VOLE correlation(s) of " << entrySize << " in the pool ("
+                  << need << " generated) after " << offlineMs << " ms" << std::endl;
+
+        oprfSend.mPool = &sendPool;
+        oprfRecv.mPool = &recvPool;
+    }
     
     // 生成测试数据
     std::vector<block> receiverInputs(n), oprfOutputs(n);
@@ -216,6 +335,10 @@ void perfOPRF(oc::CLP& cmd)
     for (u64 i = 0; i < t; ++i) {
         timer.setTimePoint("trial_" + std::to_string(i) + "_begin");
         
+        // 池中的相关性可能还在后台生成，在协程外等待
+        if (usePool && !waitPools(1))
+            return;
+
         // 记录OPRF开始时间
         oprfStarts[i] = std::chrono::high_resolution_clock::now();
         
@@ -249,6 +372,9 @@ void perfOPRF(oc::CLP& cmd)
         
         timer.setTimePoint("trial_" + std::to_string(i) + "_end");
     }
+
+    if (producer.joinable())
+        producer.join();
     
     auto totalEnd = std::chrono::high_resolution_clock::now();
     
@@ -274,6 +400,8 @@ void perfOPRF(oc::CLP& cmd)
         std::cout << "Total time: " << totalTime << " ms" << std::endl;
         std::cout << "Pure OPRF time: " << totalOprfTime << " ms" << std::endl;
         std::cout << "Average OPRF time per trial: " << totalOprfTime / t << " ms" << std::endl;
+        if (usePool)
+            std::cout << "(online only: VOLE correlations were taken from the pool)" << std::endl;
         std::cout << "OPRF time per element: " << totalOprfTime / (t * n) << " ms/element" << std::endl;
         
         std::cout << "\nCommunication:" << std::endl;
@@ -305,6 +433,12 @@ int main(int argc, char** argv){
     cmd.parse(argc, argv);
     if (cmd.isSet("paxos")) {
         perfPaxos(cmd);  
+    } else if (cmd.isSet("band")) {
+        perfBand(cmd);
+    } else if (cmd.isSet("valuePrf")) {
+        benchValuePrf(cmd.getOr("n", 1ull << 20), cmd.getOr("t", 1));
+    } else if (cmd.isSet("match")) {
+        benchMatch(cmd.getOr("n", 1ull << 24), cmd.getOr("rate", 64), cmd.getOr("t", 0));
     } else if (cmd.isSet("gen")) {
         testGen(cmd);
     } else if (cmd.isSet("oprf")) {
@@ -4,6 +4,8 @@
 #include "volePSI/RsCpsi.h"
 #include "volePSI/SimpleIndex.h"
 #include "libdivide.h"
+#include <fstream>
+#include <thread>
 using namespace oc;
 using namespace volePSI;;
 
@@ -80,6 +82,32 @@ void perfMod(oc::CLP& cmd)
 			//vals[i + 3] -= temp64[3] * mod;
 		}
 	};
+	auto fastRangeRoutine = [&] {
+
+		PaxosHash<u32> hasher;
+		hasher.mMode = PaxosHashMode::FastRange;
+		hasher.mModVals.emplace_back(mod);
+		for (u64 i = 0; i < n; i += 32)
+		{
+			hasher.mod32(&vals[i], 0);
+		}
+	};
+
+	// fast range is not x % mod, check against the scalar definition.
+	auto checkFastRange = [&](std::string name) {
+		std::vector<u64> v2(n);
+		rand(v2);
+
+		for (u64 i = 0; i < n; ++i)
+		{
+			if (vals[i] != fastRange(v2[i], mod))
+			{
+				std::cout << name << std::endl;
+				throw RTE_LOC;
+			}
+		}
+	};
+
 	oc::Timer timer;
 	rand(vals);
 	timer.setTimePoint("start");
@@ -100,6 +128,12 @@ void perfMod(oc::CLP& cmd)
 	libDivRoutine();
 	timer.setTimePoint("ibdivide");
 	check("libDiv");
+	rand(vals);
+	timer.setTimePoint("rand");
+
+	fastRangeRoutine();
+	timer.setTimePoint("fastRange");
+	checkFastRange("fastRange");
 
 	std::cout << timer << std::endl;
 
@@ -116,13 +150,14 @@ void perfBaxos(oc::CLP& cmd)
 	auto ssp = cmd.getOr("ssp", 40);
 	auto dt = cmd.isSet("binary") ? PaxosParam::Binary : PaxosParam::GF128;
 	auto nt = cmd.getOr("nt", 0);
+	auto mode = cmd.isSet("fastRange") ? PaxosHashMode::FastRange : PaxosHashMode::LibDivide;
 
 	//PaxosParam pp(n, w, ssp, dt);
 	auto binSize = 1 << cmd.getOr("lbs", 15);
 	u64 baxosSize;
 	{
 		Baxos paxos;
-		paxos.init(n, binSize, w, ssp, dt, oc::ZeroBlock);
+		paxos.init(n, binSize, w, ssp, dt, oc::ZeroBlock, mode);
 		baxosSize = paxos.size();
 	}
 	std::vector<block> key(n), val(n), pax(baxosSize);
@@ -130,17 +165,41 @@ void perfBaxos(oc::CLP& cmd)
 	prng.get<block>(key);
 	prng.get<block>(val);
 
+	// with -check every trial uses fresh keys and counts the trials where
+	// encoding throws or decoding does not return the values.
+	auto checkRate = cmd.isSet("check");
+	std::vector<block> out(checkRate ? n : 0);
+	u64 encodeFail = 0, decodeFail = 0;
+
 	Timer timer;
 	auto start = timer.setTimePoint("start");
 	auto end = start;
 	for (u64 i = 0; i < t; ++i)
 	{
 		Baxos paxos;
-		paxos.init(n, binSize, w, ssp, dt, block(i, i));
+		paxos.init(n, binSize, w, ssp, dt, block(i, i), mode);
 
 		//if (v > 1)
 		//	paxos.setTimer(timer);
 
+		if (checkRate)
+		{
+			prng.get<block>(key);
+			try {
+				paxos.solve<block>(key, val, pax, nullptr, nt);
+			}
+			catch (...)
+			{
+				++encodeFail;
+				continue;
+			}
+			paxos.decode<block>(key, out, pax, nt);
+			if (out != val)
+				++decodeFail;
+			end = timer.setTimePoint("t" + std::to_string(i));
+			continue;
+		}
+
 		paxos.solve<block>(key, val, pax, nullptr, nt);
 		timer.setTimePoint("s" + std::to_string(i));
 
@@ -154,9 +213,69 @@ void perfBaxos(oc::CLP& cmd)
 
 	auto tt = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / double(1000);
 	std::cout << "total " << tt << "ms, e=" << double(baxosSize) / n << std::endl;
+
+	if (checkRate)
+	{
+		std::cout << (mode == PaxosHashMode::FastRange ? "fastRange" : "libDivide")
+			<< " encode failures " << encodeFail << "/" << t
+			<< ", decode failures " << decodeFail << "/" << t << std::endl;
+		if (decodeFail)
+			throw RTE_LOC;
+	}
 }
 
 
+void perfSimpleIndex(oc::CLP& cmd)
+{
+	auto n = cmd.getOr("n", 1ull << cmd.getOr("nn", 20));
+	auto t = cmd.getOr("t", 1ull);
+	auto nt = cmd.getOr("nt", std::max<u64>(1, std::thread::hardware_concurrency()));
+	auto ssp = cmd.getOr("ssp", 40);
+	auto numBins = cmd.getOr("m", n * 127 / 100 + 1);
+
+	std::vector<block> items(n);
+	PRNG prng(ZeroBlock);
+
+	// every trial inserts fresh items on one thread and on nt threads. Both
+	// must give the same bins, with the items in the same order.
+	Timer timer;
+	double single = 0, multi = 0;
+	u64 binSize = 0;
+	for (u64 i = 0; i < t; ++i)
+	{
+		prng.get<block>(items);
+		SimpleIndex s, m;
+		s.init(numBins, n, ssp);
+		m.init(numBins, n, ssp);
+		binSize = s.mMaxBinSize;
+
+		auto t0 = timer.setTimePoint("s" + std::to_string(i));
+		s.insertItems(items, block(i, i), 1);
+		auto t1 = timer.setTimePoint("m" + std::to_string(i));
+		m.insertItems(items, block(i, i), nt);
+		auto t2 = timer.setTimePoint("d" + std::to_string(i));
+
+		single += std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count() / double(1000);
+		multi += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count() / double(1000);
+
+		if (s.mBinSizes != m.mBinSizes)
+			throw RTE_LOC;
+		for (u64 j = 0; j < n; ++j)
+			for (u64 h = 0; h < s.mNumHashFunctions; ++h)
+				if (s.mItemToBinMap(j, h) != m.mItemToBinMap(j, h))
+					throw RTE_LOC;
+		for (u64 b = 0; b < numBins; ++b)
+			for (u64 k = 0; k < s.mBinSizes[b]; ++k)
+				if (s.mBins(b, k).idx() != m.mBins(b, k).idx() ||
+					s.mBins(b, k).hashIdx() != m.mBins(b, k).hashIdx())
+					throw RTE_LOC;
+	}
+
+	std::cout << "simple index n=" << n << " bins=" << numBins << " binSize=" << binSize
+		<< ": 1 thread " << single / t << "ms, " << nt << " threads " << multi / t
+		<< "ms, speedup " << single / multi << ", bins match" << std::endl;
+}
+
 template<typename T>
 void perfBuildRowImpl(oc::CLP& cmd)
 {
@@ -168,8 +287,9 @@ void perfBuildRowImpl(oc::CLP& cmd)
 	auto w = cmd.getOr("w", 3);
 	auto ssp = cmd.getOr("ssp", 40);
 	auto dt = cmd.isSet("binary") ? PaxosParam::Binary : PaxosParam::GF128;
+	auto mode = cmd.isSet("fastRange") ? PaxosHashMode::FastRange : PaxosHashMode::LibDivide;
 
-	PaxosParam pp(n, w, ssp, dt);
+	PaxosParam pp(n, w, ssp, dt, mode);
 	//std::cout << "e=" << pp.size() / double(n) << std::endl;
 	if (maxN < pp.size())
 	{
@@ -521,36 +641,31 @@ void perf(oc::CLP& cmd)
 		perfBuildRow(cmd);
 	if (cmd.isSet("mod"))
 		perfMod(cmd);
+	if (cmd.isSet("simpleIndex"))
+		perfSimpleIndex(cmd);
 }
 
 
 
 void overflow(CLP& cmd)
 {
-	auto statSecParam = 40;
-	std::vector<std::vector<u64>> sizes;
-	for (u64 numBins = 1; numBins <= (1ull << 32); numBins *= 2)
+	// regenerate BinSizeTable.h, eg ./perf -overflow -o BinSizeTable.h
+	if (cmd.isSet("o"))
 	{
-		sizes.emplace_back();
-		try {
-			for (u64 numBalls = 1; numBalls <= (1ull << 32); numBalls *= 2)
-			{
-				auto s0 = SimpleIndex::get_bin_size(numBins, numBalls, statSecParam, true);
-				sizes.back().push_back(s0);
-				std::cout << numBins << " " << numBalls << " " << s0 << std::endl;
-			}
-		}
-		catch (...) {}
+		std::ofstream out(cmd.get<std::string>("o"));
+		SimpleIndex::printBinSizeTable(out);
+		return;
 	}
 
-	for (u64 i = 0; i < sizes.size(); ++i)
+	// otherwise compare the table against the exact computation.
+	auto statSecParam = cmd.getOr("ssp", 40);
+	for (u64 numBins = 2; numBins <= (1ull << 32); numBins *= 2)
 	{
-		std::cout << "/*" << i << "*/ {{ ";
-		for (u64 j = 0; j < sizes[i].size(); ++j)
+		for (u64 numBalls = numBins; numBalls <= (1ull << 40); numBalls *= 4)
 		{
-			if (j) std::cout << ", ";
-			std::cout << std::log2(sizes[i][j]);
+			auto s0 = SimpleIndex::get_bin_size(numBins, numBalls, statSecParam, true);
+			auto s1 = SimpleIndex::get_bin_size(numBins, numBalls, statSecParam, false);
+			std::cout << numBins << " " << numBalls << " " << s0 << " " << s1 << std::endl;
 		}
-		std::cout << " }}," << std::endl;
 	}
 }
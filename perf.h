@@ -11,6 +11,7 @@
 
 void overflow(oc::CLP& cmd);
 void perfMod(oc::CLP& cmd);
+void perfSimpleIndex(oc::CLP& cmd);
 
 void perfPaxos(oc::CLP& cmd);
 void perfPSI(oc::CLP& cmd);